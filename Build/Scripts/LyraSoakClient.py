@@ -0,0 +1,72 @@
+# Copyright Epic Games, Inc. All Rights Reserved.
+
+"""
+Drives a soak test on a Lyra server started with -rpcport=<port> and streams the metrics to a JSON lines file.
+
+The soak RPCs only accept requests from the local machine, so run this next to the server, e.g.:
+
+    LyraServer.sh /ShooterMaps/Maps/L_Expanse -log -rpcport=11223 -externalrpclistenaddress=127.0.0.1
+    python3 LyraSoakClient.py --port 11223 --bots 16 --duration 3600 --out soak.jsonl
+"""
+
+import argparse
+import json
+import sys
+import time
+import urllib.request
+
+
+def rpc(port, verb, path, body=None):
+    data = json.dumps(body).encode("utf-8") if body is not None else None
+    request = urllib.request.Request("http://127.0.0.1:%d%s" % (port, path), data=data, method=verb)
+    request.add_header("Content-Type", "application/json")
+    with urllib.request.urlopen(request, timeout=10) as response:
+        return json.loads(response.read().decode("utf-8") or "{}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Lyra soak test client")
+    parser.add_argument("--port", type=int, required=True, help="The -rpcport the server was started with")
+    parser.add_argument("--bots", type=int, default=16, help="Bots to add on top of the experience defaults")
+    parser.add_argument("--duration", type=float, default=0.0, help="Seconds to soak for, 0 runs until interrupted")
+    parser.add_argument("--interval", type=float, default=10.0, help="Seconds between metrics samples")
+    parser.add_argument("--no-fire", action="store_true", help="Disable the scripted fire loop")
+    parser.add_argument("--no-move", action="store_true", help="Disable the scripted move loop")
+    parser.add_argument("--out", default="soak.jsonl", help="File the metrics samples are appended to")
+    args = parser.parse_args()
+
+    print(rpc(args.port, "POST", "/soak/start", {
+        "bots": args.bots,
+        "fire": not args.no_fire,
+        "move": not args.no_move,
+        "duration": args.duration,
+    }))
+
+    try:
+        with open(args.out, "a") as out_file:
+            while True:
+                time.sleep(args.interval)
+                metrics = rpc(args.port, "GET", "/soak/metrics")
+                metrics["timestamp"] = time.time()
+                out_file.write(json.dumps(metrics) + "\n")
+                out_file.flush()
+
+                frame_times = metrics.get("frameTimeMs", {})
+                print("t=%6.0fs p50=%.2fms p99=%.2fms peakMem=%dMB objects=%d bots=%d" % (
+                    metrics.get("elapsedSeconds", 0.0),
+                    frame_times.get("p50", 0.0),
+                    frame_times.get("p99", 0.0),
+                    metrics.get("memory", {}).get("peakUsedPhysical", 0) // (1024 * 1024),
+                    metrics.get("objects", {}).get("count", 0),
+                    metrics.get("bots", 0)))
+
+                if not metrics.get("running", False):
+                    break
+    except KeyboardInterrupt:
+        rpc(args.port, "POST", "/soak/stop")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
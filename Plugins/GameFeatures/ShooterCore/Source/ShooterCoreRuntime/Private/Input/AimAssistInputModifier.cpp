@@ -173,7 +173,6 @@ float FAimAssistSettings::GetTargetWeightMaxTime() const
 
 void FAimAssistOwnerViewData::UpdateViewData(const APlayerController* PC)
 {
-	FSceneViewProjectionData ProjectionData;
 	PlayerController = PC;
 	LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
 
@@ -184,21 +183,44 @@ void FAimAssistOwnerViewData::UpdateViewData(const APlayerController* PC)
 	}
 	
 	const APawn* Pawn = Cast<APawn>(PlayerController->GetPawn());
+
+	// The local player keeps the view from the last camera update, so the matrices don't need to be built again here
+	const ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(LocalPlayer);
+	const FLyraLocalPlayerViewSnapshot* ViewSnapshot = LyraLocalPlayer ? &LyraLocalPlayer->GetViewSnapshot() : nullptr;
 	
-	if (!Pawn || !LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+	if (!Pawn)
 	{
 		ResetViewData();
 		return;
 	}
 
-	FVector ViewLocation;
-	FRotator ViewRotation;
-	PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	if (ViewSnapshot && ViewSnapshot->IsCurrent())
+	{
+		ProjectionMatrix = ViewSnapshot->ProjectionData.ProjectionMatrix;
+		ViewProjectionMatrix = ViewSnapshot->ViewProjectionMatrix;
+		ViewRect = ViewSnapshot->ViewRect;
+		ViewTransform = FTransform(ViewSnapshot->ViewRotation, ViewSnapshot->ViewLocation);
+	}
+	else
+	{
+		// No snapshot from the latest camera update, e.g. the player isn't driven by a Lyra player controller
+		FSceneViewProjectionData ProjectionData;
+		if (!LocalPlayer->ViewportClient || !LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+		{
+			ResetViewData();
+			return;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		ProjectionMatrix = ProjectionData.ProjectionMatrix;
+		ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+		ViewRect = ProjectionData.GetConstrainedViewRect();
+		ViewTransform = FTransform(ViewRotation, ViewLocation);
+	}
 
-	ProjectionMatrix = ProjectionData.ProjectionMatrix;
-	ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
-	ViewRect = ProjectionData.GetConstrainedViewRect();
-	ViewTransform = FTransform(ViewRotation, ViewLocation);
 	ViewForward = ViewTransform.GetUnitAxis(EAxis::X);
 
 	const FVector OldLocation = PlayerTransform.GetTranslation();
@@ -591,11 +613,11 @@ void UAimAssistInputModifier::UpdateTargetData(float DeltaTime)
 	}
 }
 
-const float UAimAssistInputModifier::GetSensitivtyScalar(const ULyraSettingsShared* SharedSettings) const
+const float UAimAssistInputModifier::GetSensitivtyScalar(const FLyraInputSettingsSnapshot* InputSettings) const
 {
-	if (SharedSettings && SensitivityLevelTable)
+	if (InputSettings && SensitivityLevelTable)
 	{
-		const ELyraGamepadSensitivity Sens = TargetingType == ELyraTargetingType::Normal ? SharedSettings->GetGamepadLookSensitivityPreset() : SharedSettings->GetGamepadTargetingSensitivityPreset();
+		const ELyraGamepadSensitivity Sens = TargetingType == ELyraTargetingType::Normal ? InputSettings->GamepadLookSensitivityPreset : InputSettings->GamepadTargetingSensitivityPreset;
 		return SensitivityLevelTable->SensitivtyEnumToFloat(Sens);
 	}
 	
@@ -619,10 +641,10 @@ FRotator UAimAssistInputModifier::UpdateRotationalVelocity(APlayerController* PC
 
 	if (ULyraLocalPlayer* LP = Cast<ULyraLocalPlayer>(PC->GetLocalPlayer()))
 	{
-		ULyraSettingsShared* SharedSettings = LP->GetSharedSettings();
-		LookStickDeadzone = SharedSettings->GetGamepadLookStickDeadZone();
-		MoveStickDeadzone = SharedSettings->GetGamepadMoveStickDeadZone();
-		SettingStrengthScalar = GetSensitivtyScalar(SharedSettings);
+		const FLyraInputSettingsSnapshot& InputSettings = LP->GetSharedSettings()->GetInputSettingsSnapshot();
+		LookStickDeadzone = InputSettings.GamepadLookStickDeadZone;
+		MoveStickDeadzone = InputSettings.GamepadMoveStickDeadZone;
+		SettingStrengthScalar = GetSensitivtyScalar(&InputSettings);
 	}
 	
 	for (const FLyraAimAssistTarget& Target : TargetCache)
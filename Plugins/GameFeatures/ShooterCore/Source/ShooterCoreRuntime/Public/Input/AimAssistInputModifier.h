@@ -15,7 +15,7 @@ class UInputAction;
 class ULocalPlayer;
 class UShapeComponent;
 class ULyraAimSensitivityData;
-class ULyraSettingsShared;
+struct FLyraInputSettingsSnapshot;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAimAssist, Log, All);
 
@@ -374,7 +374,7 @@ protected:
 
 	bool HasAnyCurrentTargets() const { return !GetCurrentTargetCache().IsEmpty(); }
 
-	const float GetSensitivtyScalar(const ULyraSettingsShared* SharedSettings) const;
+	const float GetSensitivtyScalar(const FLyraInputSettingsSnapshot* InputSettings) const;
 	
 	// Tracking of the current and previous frame's targets
 	UPROPERTY()
@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CQTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "Misc/ConfigCacheIni.h"
+#include "Scalability.h"
+#include "Settings/LyraSettingsLocal.h"
+
+/**
+ * Creates a standalone test object using the name from the first parameter, in the case `AdaptiveQualitySaveTest`, which inherits from `TTest<Derived, AsserterType>` to provide us our testing functionality.
+ * The second parameter specifies the category and subcategories used for displaying within the UI
+ *
+ * The test object runs the local settings at levels lowered by the adaptive quality governor, saves them,
+ * and checks that the scalability groups written to the ini are still the user's own levels.
+ * Everything the test changes (user levels, running levels and the saved groups) is restored afterwards.
+ */
+TEST_CLASS(AdaptiveQualitySaveTest, "Project.Functional Tests.ShooterTests.Settings")
+{
+	/** Level the user picked for every group during the test. */
+	static constexpr int32 UserLevel = 3;
+
+	ULyraSettingsLocal* Settings = nullptr;
+	Scalability::FQualityLevels OriginalRunningLevels;
+	Scalability::FQualityLevels OriginalUserLevels;
+	TMap<FString, FString> OriginalSavedGroups;
+
+	const FString& GetScalabilityIni() const
+	{
+		return GIsEditor ? GEditorSettingsIni : GGameUserSettingsIni;
+	}
+
+	static void SetUserLevels(ULyraSettingsLocal* InSettings, const Scalability::FQualityLevels& Levels)
+	{
+		InSettings->SetViewDistanceQuality(Levels.ViewDistanceQuality);
+		InSettings->SetAntiAliasingQuality(Levels.AntiAliasingQuality);
+		InSettings->SetShadowQuality(Levels.ShadowQuality);
+		InSettings->SetGlobalIlluminationQuality(Levels.GlobalIlluminationQuality);
+		InSettings->SetReflectionQuality(Levels.ReflectionQuality);
+		InSettings->SetPostProcessingQuality(Levels.PostProcessQuality);
+		InSettings->SetTextureQuality(Levels.TextureQuality);
+		InSettings->SetVisualEffectQuality(Levels.EffectsQuality);
+		InSettings->SetFoliageQuality(Levels.FoliageQuality);
+		InSettings->SetShadingQuality(Levels.ShadingQuality);
+	}
+
+	BEFORE_EACH()
+	{
+		Settings = ULyraSettingsLocal::Get();
+		ASSERT_THAT(IsNotNull(Settings));
+
+		OriginalRunningLevels = Scalability::GetQualityLevels();
+
+		OriginalUserLevels.ViewDistanceQuality = Settings->GetViewDistanceQuality();
+		OriginalUserLevels.AntiAliasingQuality = Settings->GetAntiAliasingQuality();
+		OriginalUserLevels.ShadowQuality = Settings->GetShadowQuality();
+		OriginalUserLevels.GlobalIlluminationQuality = Settings->GetGlobalIlluminationQuality();
+		OriginalUserLevels.ReflectionQuality = Settings->GetReflectionQuality();
+		OriginalUserLevels.PostProcessQuality = Settings->GetPostProcessingQuality();
+		OriginalUserLevels.TextureQuality = Settings->GetTextureQuality();
+		OriginalUserLevels.EffectsQuality = Settings->GetVisualEffectQuality();
+		OriginalUserLevels.FoliageQuality = Settings->GetFoliageQuality();
+		OriginalUserLevels.ShadingQuality = Settings->GetShadingQuality();
+
+		if (const FConfigSection* Section = GConfig->GetSection(TEXT("ScalabilityGroups"), /*bForce*/ false, GetScalabilityIni()))
+		{
+			for (const TPair<FName, FConfigValue>& Pair : *Section)
+			{
+				OriginalSavedGroups.Add(Pair.Key.ToString(), Pair.Value.GetSavedValue());
+			}
+		}
+	}
+
+	AFTER_EACH()
+	{
+		if (Settings == nullptr)
+		{
+			return;
+		}
+
+		// Hand the running levels back to the settings before restoring what the engine was running at
+		SetUserLevels(Settings, OriginalUserLevels);
+		Settings->SetAdaptiveQualityLevelsForTesting(OriginalUserLevels);
+		Scalability::SetQualityLevels(OriginalRunningLevels);
+
+		GConfig->EmptySection(TEXT("ScalabilityGroups"), GetScalabilityIni());
+		for (const TPair<FString, FString>& SavedGroup : OriginalSavedGroups)
+		{
+			GConfig->SetString(TEXT("ScalabilityGroups"), *SavedGroup.Key, *SavedGroup.Value, GetScalabilityIni());
+		}
+		GConfig->Flush(false, GetScalabilityIni());
+	}
+
+	TEST_METHOD(SaveWhileLowered_SavesUserLevels)
+	{
+		Scalability::FQualityLevels UserLevels;
+		UserLevels.SetFromSingleQualityLevel(UserLevel);
+		SetUserLevels(Settings, UserLevels);
+
+		// The governor gives up shadows and effects first
+		Scalability::FQualityLevels LoweredLevels = UserLevels;
+		LoweredLevels.ShadowQuality = UserLevel - 2;
+		LoweredLevels.EffectsQuality = UserLevel - 1;
+		Settings->SetAdaptiveQualityLevelsForTesting(LoweredLevels);
+
+		const bool bWasPersisting = Settings->ShouldPersistAdaptiveQualityChanges();
+		Settings->SetPersistAdaptiveQualityChanges(false);
+		Settings->SaveSettings();
+		Settings->SetPersistAdaptiveQualityChanges(bWasPersisting);
+
+		for (const TCHAR* Key : { TEXT("sg.ShadowQuality"), TEXT("sg.EffectsQuality"), TEXT("sg.FoliageQuality") })
+		{
+			int32 SavedLevel = INDEX_NONE;
+			GConfig->GetInt(TEXT("ScalabilityGroups"), Key, /*out*/ SavedLevel, GetScalabilityIni());
+			ASSERT_THAT(AreEqual(SavedLevel, UserLevel, Key));
+		}
+
+		// Saving mustn't change what the engine is running at
+		ASSERT_THAT(AreEqual(Scalability::GetQualityLevels().ShadowQuality, LoweredLevels.ShadowQuality));
+		ASSERT_THAT(AreEqual(Scalability::GetQualityLevels().EffectsQuality, LoweredLevels.EffectsQuality));
+	}
+};
+
+#endif // WITH_AUTOMATION_TESTS
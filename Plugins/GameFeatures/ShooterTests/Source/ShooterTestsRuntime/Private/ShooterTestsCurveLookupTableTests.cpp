@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CQTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+#include "Curves/RichCurve.h"
+#include "Weapons/LyraCurveLookupTable.h"
+
+/**
+ * Creates a standalone test object using the name from the first parameter, in the case `CurveLookupTableTest`, which inherits from `TTest<Derived, AsserterType>` to provide us our testing functionality.
+ * The second parameter specifies the category and subcategories used for displaying within the UI
+ *
+ * The test object bakes curves shaped like the ranged weapon heat, spread and damage falloff curves into a `FLyraCurveLookupTable`
+ * and checks the baked values against the rich curve they were baked from, inside and outside of the key range.
+ * The test doesn't need a world, so it runs in every context.
+ */
+TEST_CLASS(CurveLookupTableTest, "Project.Functional Tests.ShooterTests.Weapons")
+{
+	/** Number of times each curve is evaluated, more than the number of samples so values between samples are checked as well. */
+	static constexpr int32 NumEvaluations = FLyraCurveLookupTable::NumSamples * 8;
+
+	FRichCurve Curve;
+	FLyraCurveLookupTable Table;
+
+	// Evaluates the table over the key range extended on both sides and compares it to the curve
+	void ExpectMatchesCurve(float Tolerance)
+	{
+		ASSERT_THAT(IsTrue(Table.IsBaked()));
+
+		float MinTime;
+		float MaxTime;
+		Curve.GetTimeRange(/*out*/ MinTime, /*out*/ MaxTime);
+		const float Margin = FMath::Max((MaxTime - MinTime) * 0.25f, 1.0f);
+
+		for (int32 Index = 0; Index <= NumEvaluations; ++Index)
+		{
+			const float Time = FMath::Lerp(MinTime - Margin, MaxTime + Margin, static_cast<float>(Index) / NumEvaluations);
+			ASSERT_THAT(IsNear(Table.Eval(Time, Curve), Curve.Eval(Time), Tolerance, *FString::Printf(TEXT("Value at %.3f"), Time)));
+		}
+	}
+
+	TEST_METHOD(FlatCurve_MatchesExactly)
+	{
+		// Heat per shot and cooldown curves are typically a single key
+		Curve.AddKey(0.0f, 2.0f);
+		Table.Bake(Curve);
+
+		ExpectMatchesCurve(UE_KINDA_SMALL_NUMBER);
+	}
+
+	TEST_METHOD(LinearCurve_MatchesWithinTolerance)
+	{
+		// Heat to spread, with the keys deliberately not on sample boundaries
+		for (const FVector2f& Key : { FVector2f(0.0f, 1.0f), FVector2f(3.7f, 2.5f), FVector2f(9.1f, 6.0f), FVector2f(10.0f, 6.5f) })
+		{
+			Curve.SetKeyInterpMode(Curve.AddKey(Key.X, Key.Y), RCIM_Linear);
+		}
+		Table.Bake(Curve);
+
+		ExpectMatchesCurve(0.02f);
+	}
+
+	TEST_METHOD(CubicFalloffCurve_MatchesWithinTolerance)
+	{
+		// Distance damage falloff over the default max damage range, in cm
+		for (const FVector2f& Key : { FVector2f(0.0f, 1.0f), FVector2f(1500.0f, 1.0f), FVector2f(6000.0f, 0.6f), FVector2f(25000.0f, 0.25f) })
+		{
+			Curve.SetKeyInterpMode(Curve.AddKey(Key.X, Key.Y), RCIM_Cubic);
+		}
+		Curve.AutoSetTangents();
+		Table.Bake(Curve);
+
+		ExpectMatchesCurve(0.005f);
+	}
+
+	TEST_METHOD(SteppedCurve_FallsBackToCurve)
+	{
+		Curve.SetKeyInterpMode(Curve.AddKey(0.0f, 1.0f), RCIM_Constant);
+		Curve.SetKeyInterpMode(Curve.AddKey(5.0f, 3.0f), RCIM_Constant);
+		Table.Bake(Curve);
+
+		ASSERT_THAT(IsFalse(Table.IsBaked()));
+		ASSERT_THAT(AreEqual(Table.Eval(4.9f, Curve), Curve.Eval(4.9f)));
+		ASSERT_THAT(AreEqual(Table.Eval(5.1f, Curve), Curve.Eval(5.1f)));
+	}
+
+	TEST_METHOD(LinearExtrapolation_FallsBackToCurve)
+	{
+		Curve.AddKey(0.0f, 0.0f);
+		Curve.AddKey(1.0f, 1.0f);
+		Curve.PostInfinityExtrap = RCCE_Linear;
+		Table.Bake(Curve);
+
+		ASSERT_THAT(IsFalse(Table.IsBaked()));
+		ASSERT_THAT(AreEqual(Table.Eval(3.0f, Curve), Curve.Eval(3.0f)));
+	}
+};
+
+#endif // WITH_AUTOMATION_TESTS
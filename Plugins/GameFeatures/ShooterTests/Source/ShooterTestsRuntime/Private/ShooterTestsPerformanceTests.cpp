@@ -0,0 +1,170 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Utilities/ShooterTestsActorNetworkTest.h"
+
+#if ENABLE_SHOOTERTESTS_NETWORK_TEST
+
+#include "Engine/GameInstance.h"
+#include "Engine/NetDriver.h"
+#include "NetworkReplayStreaming.h"
+#include "Replays/LyraReplaySubsystem.h"
+#include "Tests/LyraSoakTestDriver.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Utilities/ShooterTestsPerformanceTestHelper.h"
+
+/**
+ * Creates a standalone test object using the name from the first parameter, in the case `PerformanceRegressionTest`, which inherits from `ShooterTestsBaseActorNetworkTest<Derived, AsserterType>` to provide us our testing functionality.
+ * The second parameter specifies the category and subcategories used for displaying within the UI
+ * The third parameter specifies the base class and the fourth the flags as to what context the test will run in and the filter to be applied for the test to appear in the UI
+ *
+ * The test object loads a fixed map in a listen server and client PIE session, adds scripted bots on the server through the `ULyraSoakTestDriver` and measures the server
+ * over a fixed window. The game thread time, replication bytes and allocation counts are then compared against the stored baseline, see `FShooterTestsPerformanceBaseline`.
+ * The PIE session runs the server and the client in a single process on one game thread, so the "server" game thread time includes the client's work too.
+ * The test does not need a renderer so it can be run headless, e.g. `UnrealEditor-Cmd LyraStarterGame.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Project.Functional Tests.ShooterTests.Performance;Quit"`
+ *
+ * The test makes use of the `TestCommandBuilder` to queue up latent commands to be executed on every Tick of the Engine/Editor
+ * `ThenServer` steps will execute within a single tick on the server
+ * `UntilServer` steps will keep executing each tick on the server until the predicate has evaluated to true or the timeout period has elapsed. The latter will fail the test.
+ */
+TEST_CLASS_WITH_BASE_AND_FLAGS(PerformanceRegressionTest, "Project.Functional Tests.ShooterTests.Performance", ShooterTestsBaseActorNetworkTest, EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+{
+	/** Number of bots added on top of the ones spawned by the experience. */
+	static constexpr int32 NumBotsToAdd = 8;
+
+	/** Time given to the bots to spawn in and settle before measuring. */
+	static constexpr double WarmupSeconds = 5.0;
+
+	/** Length of the measurement window. */
+	static constexpr double WindowSeconds = 15.0;
+
+	// Make a call to our base Constructor to set level to load
+	PerformanceRegressionTest() : ShooterTestsBaseActorNetworkTest(TEXT("/ShooterTests/Maps/L_ShooterTest_Basic"))
+	{
+	}
+
+	/** Drives the bots on the server, kept alive by the test for the duration of the run. */
+	TStrongObjectPtr<ULyraSoakTestDriver> SoakDriver;
+
+	FShooterTestsPerformanceSampler Sampler;
+
+	/** Second window used by tests which compare the server with and without an extra feature enabled. */
+	FShooterTestsPerformanceSampler FeatureSampler;
+
+	double WarmupStartTime = 0.0;
+
+	/** Server replay recorded by the test, deleted again once it has been measured. */
+	FString RecordedReplayName;
+	TSharedPtr<INetworkReplayStreamer> ReplayDeleteStreamer;
+	bool bReplayDeletePending = false;
+	bool bReplayDeleted = false;
+
+	TEST_METHOD(ScriptedBots_StayWithinBaseline)
+	{
+		Network
+			.ThenServer(TEXT("Adding scripted bots on the server."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				FLyraSoakTestParams Params;
+				Params.NumBotsToAdd = NumBotsToAdd;
+
+				FString Error;
+				SoakDriver.Reset(NewObject<ULyraSoakTestDriver>());
+				ASSERT_THAT(IsTrue(SoakDriver->StartSoak(ServerState.World, Params, Error), *Error));
+				WarmupStartTime = FPlatformTime::Seconds();
+			})
+			.UntilServer(TEXT("Waiting for the bots to settle."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				return (FPlatformTime::Seconds() - WarmupStartTime) >= WarmupSeconds;
+			}, FTimespan::FromSeconds(WarmupSeconds * 4))
+			.ThenServer(TEXT("Starting the measurement window."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				Sampler.BeginWindow(ServerState.World);
+			})
+			.UntilServer(TEXT("Sampling the server frames."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				Sampler.SampleFrame();
+				return Sampler.GetWindowSeconds() >= WindowSeconds;
+			}, FTimespan::FromSeconds(WindowSeconds * 4))
+			.ThenServer(TEXT("Comparing the measurements against the baseline."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				Sampler.EndWindow();
+				SoakDriver->StopSoak();
+
+				FShooterTestsPerformanceBaseline Baseline(TEXT("PerformanceRegressionTest"));
+				Baseline.CheckMetric(TestRunner, TEXT("GameThreadMs"), Sampler.GetAverageGameThreadMs());
+				Baseline.CheckMetric(TestRunner, TEXT("GameThreadP95Ms"), Sampler.GetP95GameThreadMs());
+				Baseline.CheckMetric(TestRunner, TEXT("ReplicationBytesPerSecond"), Sampler.GetReplicationBytesPerSecond());
+				Baseline.CheckMetric(TestRunner, TEXT("ObjectAllocationsPerSecond"), Sampler.GetObjectAllocationsPerSecond());
+				Baseline.CheckMetric(TestRunner, TEXT("MemoryGrowthMB"), Sampler.GetMemoryGrowthMB());
+				Baseline.SaveIfRequested(TestRunner);
+			});
+	}
+
+	TEST_METHOD(ServerReplay_OverheadPerConnection)
+	{
+		Network
+			.ThenServer(TEXT("Adding scripted bots on the server."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				FLyraSoakTestParams Params;
+				Params.NumBotsToAdd = NumBotsToAdd;
+
+				FString Error;
+				SoakDriver.Reset(NewObject<ULyraSoakTestDriver>());
+				ASSERT_THAT(IsTrue(SoakDriver->StartSoak(ServerState.World, Params, Error), *Error));
+				WarmupStartTime = FPlatformTime::Seconds();
+			})
+			.UntilServer(TEXT("Waiting for the bots to settle."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				return (FPlatformTime::Seconds() - WarmupStartTime) >= WarmupSeconds;
+			}, FTimespan::FromSeconds(WarmupSeconds * 4))
+			.ThenServer(TEXT("Starting the window without recording."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				Sampler.BeginWindow(ServerState.World);
+			})
+			.UntilServer(TEXT("Sampling the server frames without recording."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				Sampler.SampleFrame();
+				return Sampler.GetWindowSeconds() >= WindowSeconds;
+			}, FTimespan::FromSeconds(WindowSeconds * 4))
+			.ThenServer(TEXT("Starting the server replay."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				Sampler.EndWindow();
+
+				ULyraReplaySubsystem* ReplaySubsystem = ServerState.World->GetGameInstance()->GetSubsystem<ULyraReplaySubsystem>();
+				ASSERT_THAT(IsNotNull(ReplaySubsystem));
+				ReplaySubsystem->RecordServerReplay();
+				ASSERT_THAT(IsTrue(ServerState.World->GetDemoNetDriver() != nullptr, TEXT("Server replay did not start recording")));
+				RecordedReplayName = ReplaySubsystem->GetActiveReplayName();
+
+				FeatureSampler.BeginWindow(ServerState.World);
+			})
+			.UntilServer(TEXT("Sampling the server frames while recording."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				FeatureSampler.SampleFrame();
+				return FeatureSampler.GetWindowSeconds() >= WindowSeconds;
+			}, FTimespan::FromSeconds(WindowSeconds * 4))
+			.ThenServer(TEXT("Comparing the recording overhead against the baseline."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				FeatureSampler.EndWindow();
+				SoakDriver->StopSoak();
+				ServerState.World->GetGameInstance()->StopRecordingReplay();
+
+				// Normalized per client connection so runs with a different number of clients share the baseline
+				const UNetDriver* NetDriver = ServerState.World->GetNetDriver();
+				const int32 NumConnections = FMath::Max(NetDriver ? NetDriver->ClientConnections.Num() : 0, 1);
+				const double OverheadMs = FMath::Max(FeatureSampler.GetAverageGameThreadMs() - Sampler.GetAverageGameThreadMs(), 0.0);
+
+				FShooterTestsPerformanceBaseline Baseline(TEXT("ServerReplayOverhead"));
+				Baseline.CheckMetric(TestRunner, TEXT("GameThreadMsPerConnection"), OverheadMs / NumConnections);
+				Baseline.CheckMetric(TestRunner, TEXT("MemoryGrowthMB"), FeatureSampler.GetMemoryGrowthMB());
+				Baseline.SaveIfRequested(TestRunner);
+			})
+			.UntilServer(TEXT("Deleting the recorded server replay."), [this](FShooterTestsNetworkState<FShooterTestsActorTestHelper>& ServerState) {
+				// The recording streamer may still be finishing its last writes, so retry until the delete goes through
+				if (!bReplayDeletePending && !bReplayDeleted)
+				{
+					ReplayDeleteStreamer = ULyraReplaySubsystem::CreateLocalReplayStreamer();
+					if (!ReplayDeleteStreamer.IsValid() || RecordedReplayName.IsEmpty())
+					{
+						return true;
+					}
+
+					bReplayDeletePending = true;
+					ReplayDeleteStreamer->DeleteFinishedStream(RecordedReplayName, INDEX_NONE, FDeleteFinishedStreamCallback::CreateLambda([this](const FDeleteFinishedStreamResult& Result) {
+						bReplayDeletePending = false;
+						bReplayDeleted = Result.WasSuccessful();
+					}));
+				}
+				return bReplayDeleted;
+			}, FTimespan::FromSeconds(10));
+	}
+};
+
+#endif // ENABLE_SHOOTERTESTS_NETWORK_TEST
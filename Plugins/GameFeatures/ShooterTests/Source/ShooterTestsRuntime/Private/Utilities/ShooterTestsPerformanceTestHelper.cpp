@@ -0,0 +1,242 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterTestsPerformanceTestHelper.h"
+
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+
+uint64 GetOutTotalBytes(const UWorld* World)
+{
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	return NetDriver ? NetDriver->OutTotalBytes : 0;
+}
+
+FString GetBaselinePath()
+{
+	FString BaselinePath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("ShooterTestsPerfBaseline="), BaselinePath))
+	{
+		return BaselinePath;
+	}
+
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("ShooterTests"));
+	return Plugin.IsValid() ? FPaths::Combine(Plugin->GetBaseDir(), TEXT("Config"), TEXT("ShooterTestsPerformanceBaseline.json")) : FString();
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////
+// FShooterTestsPerformanceSampler
+
+FShooterTestsPerformanceSampler::~FShooterTestsPerformanceSampler()
+{
+	StopListening();
+}
+
+void FShooterTestsPerformanceSampler::BeginWindow(UWorld* ServerWorld)
+{
+	World = ServerWorld;
+	GameThreadTimesMs.Reset();
+
+	WindowStartTime = FPlatformTime::Seconds();
+	WindowEndTime = WindowStartTime;
+	StartOutBytes = GetOutTotalBytes(ServerWorld);
+	EndOutBytes = StartOutBytes;
+	StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	EndUsedPhysical = StartUsedPhysical;
+
+	NumObjectsCreated = 0;
+	if (!bListening)
+	{
+		GUObjectArray.AddUObjectCreateListener(this);
+		bListening = true;
+	}
+}
+
+void FShooterTestsPerformanceSampler::SampleFrame()
+{
+	GameThreadTimesMs.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+}
+
+void FShooterTestsPerformanceSampler::EndWindow()
+{
+	StopListening();
+
+	WindowEndTime = FPlatformTime::Seconds();
+	EndOutBytes = GetOutTotalBytes(World.Get());
+	EndUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+}
+
+double FShooterTestsPerformanceSampler::GetWindowSeconds() const
+{
+	return FPlatformTime::Seconds() - WindowStartTime;
+}
+
+double FShooterTestsPerformanceSampler::GetAverageGameThreadMs() const
+{
+	double Total = 0.0;
+	for (double Sample : GameThreadTimesMs)
+	{
+		Total += Sample;
+	}
+	return GameThreadTimesMs.Num() > 0 ? Total / GameThreadTimesMs.Num() : 0.0;
+}
+
+double FShooterTestsPerformanceSampler::GetP95GameThreadMs() const
+{
+	if (GameThreadTimesMs.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	TArray<double> Sorted = GameThreadTimesMs;
+	Sorted.Sort();
+	return Sorted[FMath::Clamp(FMath::FloorToInt32(0.95 * (Sorted.Num() - 1)), 0, Sorted.Num() - 1)];
+}
+
+double FShooterTestsPerformanceSampler::GetReplicationBytesPerSecond() const
+{
+	const double WindowSeconds = WindowEndTime - WindowStartTime;
+	return WindowSeconds > 0.0 ? static_cast<double>(EndOutBytes - StartOutBytes) / WindowSeconds : 0.0;
+}
+
+double FShooterTestsPerformanceSampler::GetObjectAllocationsPerSecond() const
+{
+	const double WindowSeconds = WindowEndTime - WindowStartTime;
+	return WindowSeconds > 0.0 ? static_cast<double>(NumObjectsCreated.load()) / WindowSeconds : 0.0;
+}
+
+double FShooterTestsPerformanceSampler::GetMemoryGrowthMB() const
+{
+	const int64 Growth = static_cast<int64>(EndUsedPhysical) - static_cast<int64>(StartUsedPhysical);
+	return FMath::Max<int64>(Growth, 0) / (1024.0 * 1024.0);
+}
+
+void FShooterTestsPerformanceSampler::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	NumObjectsCreated.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FShooterTestsPerformanceSampler::OnUObjectArrayShutdown()
+{
+	StopListening();
+}
+
+void FShooterTestsPerformanceSampler::StopListening()
+{
+	if (bListening)
+	{
+		GUObjectArray.RemoveUObjectCreateListener(this);
+		bListening = false;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+// FShooterTestsPerformanceBaseline
+
+FShooterTestsPerformanceBaseline::FShooterTestsPerformanceBaseline(const FString& InTestName)
+	: TestName(InTestName)
+	, BaselinePath(GetBaselinePath())
+{
+	FString BaselineJson;
+	if (!BaselinePath.IsEmpty() && FFileHelper::LoadFileToString(BaselineJson, *BaselinePath))
+	{
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(BaselineJson);
+		FJsonSerializer::Deserialize(JsonReader, RootObject);
+	}
+
+	if (!RootObject.IsValid())
+	{
+		RootObject = MakeShared<FJsonObject>();
+	}
+}
+
+bool FShooterTestsPerformanceBaseline::CheckMetric(FAutomationTestBase* TestRunner, const FString& MetricName, double Measured)
+{
+	MeasuredValues.Add(MetricName, Measured);
+
+	double Baseline = 0.0;
+	double Tolerance = DefaultTolerance;
+	double AbsoluteTolerance = 0.0;
+	bool bHasBaseline = false;
+
+	const TSharedPtr<FJsonObject>* TestObject = nullptr;
+	const TSharedPtr<FJsonObject>* MetricObject = nullptr;
+	if (RootObject->TryGetObjectField(TestName, TestObject) && (*TestObject)->TryGetObjectField(MetricName, MetricObject))
+	{
+		// A null baseline fails to read as a number, same as a missing one
+		bHasBaseline = (*MetricObject)->TryGetNumberField(TEXT("Baseline"), Baseline);
+		(*MetricObject)->TryGetNumberField(TEXT("Tolerance"), Tolerance);
+		(*MetricObject)->TryGetNumberField(TEXT("AbsoluteTolerance"), AbsoluteTolerance);
+	}
+
+	if (!bHasBaseline)
+	{
+		// Only a run that is recording the baseline, or one that explicitly opts out, may pass without one
+		if (FParse::Param(FCommandLine::Get(), TEXT("ShooterTestsUpdatePerfBaseline")) || FParse::Param(FCommandLine::Get(), TEXT("ShooterTestsAllowMissingPerfBaseline")))
+		{
+			TestRunner->AddInfo(FString::Printf(TEXT("%s: %.3f (no baseline recorded)"), *MetricName, Measured));
+			return true;
+		}
+
+		TestRunner->AddError(FString::Printf(TEXT("%s: %.3f but no baseline is recorded in '%s', record one with -ShooterTestsUpdatePerfBaseline"), *MetricName, Measured, *BaselinePath));
+		return false;
+	}
+
+	const double Limit = (Baseline * (1.0 + Tolerance)) + AbsoluteTolerance;
+	if (Measured > Limit)
+	{
+		TestRunner->AddError(FString::Printf(TEXT("%s regressed: %.3f exceeds baseline %.3f by more than %.0f%% + %.3f"), *MetricName, Measured, Baseline, Tolerance * 100.0, AbsoluteTolerance));
+		return false;
+	}
+
+	TestRunner->AddInfo(FString::Printf(TEXT("%s: %.3f (baseline %.3f, limit %.3f)"), *MetricName, Measured, Baseline, Limit));
+	return true;
+}
+
+void FShooterTestsPerformanceBaseline::SaveIfRequested(FAutomationTestBase* TestRunner)
+{
+	if (!FParse::Param(FCommandLine::Get(), TEXT("ShooterTestsUpdatePerfBaseline")) || BaselinePath.IsEmpty())
+	{
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* ExistingTestObject = nullptr;
+	TSharedPtr<FJsonObject> TestObject = RootObject->TryGetObjectField(TestName, ExistingTestObject) ? *ExistingTestObject : MakeShared<FJsonObject>();
+
+	for (const TPair<FString, double>& Measured : MeasuredValues)
+	{
+		const TSharedPtr<FJsonObject>* ExistingMetricObject = nullptr;
+		TSharedPtr<FJsonObject> MetricObject = TestObject->TryGetObjectField(Measured.Key, ExistingMetricObject) ? *ExistingMetricObject : MakeShared<FJsonObject>();
+		MetricObject->SetNumberField(TEXT("Baseline"), Measured.Value);
+		if (!MetricObject->HasField(TEXT("Tolerance")))
+		{
+			MetricObject->SetNumberField(TEXT("Tolerance"), DefaultTolerance);
+		}
+		TestObject->SetObjectField(Measured.Key, MetricObject);
+	}
+	RootObject->SetObjectField(TestName, TestObject);
+
+	FString BaselineJson;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&BaselineJson);
+	if (FJsonSerializer::Serialize(RootObject.ToSharedRef(), JsonWriter) && FFileHelper::SaveStringToFile(BaselineJson, *BaselinePath))
+	{
+		TestRunner->AddInfo(FString::Printf(TEXT("Updated performance baseline '%s'"), *BaselinePath));
+	}
+	else
+	{
+		TestRunner->AddError(FString::Printf(TEXT("Failed to write performance baseline '%s'"), *BaselinePath));
+	}
+}
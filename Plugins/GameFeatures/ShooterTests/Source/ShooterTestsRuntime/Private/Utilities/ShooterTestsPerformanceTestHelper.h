@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Dom/JsonObject.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#include <atomic>
+
+class FAutomationTestBase;
+class UWorld;
+
+/// Class which samples the server's frame cost, replication traffic and allocations over a fixed window
+class FShooterTestsPerformanceSampler : public FUObjectArray::FUObjectCreateListener
+{
+public:
+	~FShooterTestsPerformanceSampler();
+
+	/**
+	 * Starts a new measurement window.
+	 *
+	 * @param ServerWorld - World whose net driver traffic is measured.
+	 */
+	void BeginWindow(UWorld* ServerWorld);
+
+	/**
+	 * Records the game thread time of the last frame.
+	 *
+	 * @note Method is expected to be called once per tick within an `Until` latent command.
+	 * @note In a single process PIE session the listen server and the client worlds tick on the same game thread, so this is the
+	 *       time of the whole frame (server and clients) rather than of the server alone. Compare it against baselines recorded
+	 *       with the same number of clients.
+	 */
+	void SampleFrame();
+
+	/** Ends the measurement window and captures the network and memory totals. */
+	void EndWindow();
+
+	/** @return the number of seconds since BeginWindow was called. */
+	double GetWindowSeconds() const;
+
+	/** @return the mean game thread time in milliseconds over the window, including the client worlds (see SampleFrame). */
+	double GetAverageGameThreadMs() const;
+
+	/** @return the 95th percentile game thread time in milliseconds over the window. */
+	double GetP95GameThreadMs() const;
+
+	/** @return the bytes sent by the server net driver per second over the window. */
+	double GetReplicationBytesPerSecond() const;
+
+	/** @return the UObjects created per second over the window. */
+	double GetObjectAllocationsPerSecond() const;
+
+	/** @return the growth of used physical memory in megabytes over the window. */
+	double GetMemoryGrowthMB() const;
+
+	//~FUObjectCreateListener interface
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+	virtual void OnUObjectArrayShutdown() override;
+	//~End of FUObjectCreateListener interface
+
+private:
+	void StopListening();
+
+	TWeakObjectPtr<UWorld> World;
+	TArray<double> GameThreadTimesMs;
+
+	double WindowStartTime = 0.0;
+	double WindowEndTime = 0.0;
+
+	uint64 StartOutBytes = 0;
+	uint64 EndOutBytes = 0;
+
+	uint64 StartUsedPhysical = 0;
+	uint64 EndUsedPhysical = 0;
+
+	// Objects can be created from the async loading thread as well
+	std::atomic<int64> NumObjectsCreated{ 0 };
+	bool bListening = false;
+};
+
+/**
+ * Class which compares measured metrics against the stored baseline.
+ *
+ * The baseline lives in the plugin's `Config/ShooterTestsPerformanceBaseline.json`, keyed by test name and then metric name.
+ * Every metric stores a `Baseline` value, a relative `Tolerance` and an optional `AbsoluteTolerance`, the limit being
+ * `Baseline * (1 + Tolerance) + AbsoluteTolerance`. Zero is a valid baseline (e.g. no memory growth), which is what the absolute
+ * tolerance is for. A missing or `null` baseline fails the test, so a regression can't pass silently because nothing was recorded,
+ * unless running with `-ShooterTestsUpdatePerfBaseline` or `-ShooterTestsAllowMissingPerfBaseline`, which only report the measured value.
+ * Running with `-ShooterTestsUpdatePerfBaseline` writes the measured values back as the new baseline,
+ * and `-ShooterTestsPerfBaseline=<path>` reads (and writes) a different file, e.g. one per build machine.
+ */
+class FShooterTestsPerformanceBaseline
+{
+public:
+	/**
+	 * Construct the baseline for a test and load the stored values.
+	 *
+	 * @param InTestName - Name of the test the metrics are stored under.
+	 */
+	explicit FShooterTestsPerformanceBaseline(const FString& InTestName);
+
+	/**
+	 * Compares a metric where lower values are better against its baseline.
+	 *
+	 * @param TestRunner - Test used to report the result, an error is added on regression.
+	 * @param MetricName - Name of the metric in the baseline file.
+	 * @param Measured - Value measured during this run.
+	 *
+	 * @return false if the metric regressed past the tolerance.
+	 */
+	bool CheckMetric(FAutomationTestBase* TestRunner, const FString& MetricName, double Measured);
+
+	/** Writes the measured values back to the baseline file if requested on the command line. */
+	void SaveIfRequested(FAutomationTestBase* TestRunner);
+
+private:
+	/** Tolerance applied to metrics which don't specify their own. */
+	static constexpr double DefaultTolerance = 0.15;
+
+	FString TestName;
+	FString BaselinePath;
+	TSharedPtr<FJsonObject> RootObject;
+	TMap<FString, double> MeasuredValues;
+};
@@ -29,6 +29,8 @@ public class ShooterTestsRuntime : ModuleRules
 				"EnhancedInput",
 				"CQTest",
 				"CQTestEnhancedInput",
+				"Json",
+				"Projects",
 				// ... add private dependencies that you statically link with here ...	
 			}
 		);
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "GameSetting.h"
+#include "GameSettingRegistry.h"
 #include "Framework/Text/ITextDecorator.h"
 #include "Framework/Text/RichTextMarkupProcessing.h"
 #include "Engine/LocalPlayer.h"
@@ -189,6 +190,9 @@ void UGameSetting::NotifySettingChanged(EGameSettingChangeReason Reason)
 	{
 		TGuardValue<bool> Guard(bOnSettingChangedEventGuard, true);
 		OnSettingChangedEvent.Broadcast(this, Reason);
+
+		// Settings that only changed because one of their dependencies did don't push that on as a value change.
+		MarkEditDependentsDirty(Reason != EGameSettingChangeReason::DependencyChanged);
 	}
 }
 
@@ -208,8 +212,7 @@ void UGameSetting::AddEditDependency(UGameSetting* DependencySetting)
 {
 	if (ensure(DependencySetting))
 	{
-		DependencySetting->OnSettingChangedEvent.AddUObject(this, &ThisClass::HandleEditDependencyChanged);
-		DependencySetting->OnSettingEditConditionChangedEvent.AddUObject(this, &ThisClass::HandleEditDependencyChanged);
+		DependencySetting->EditDependents.AddUnique(this);
 	}
 }
 
@@ -232,17 +235,40 @@ void UGameSetting::RefreshEditableState(bool bNotifyEditConditionsChanged)
 	if (!bOnEditConditionsChangedEventGuard)
 	{
 		TGuardValue<bool> Guard(bOnEditConditionsChangedEventGuard, true);
-	
-		EditableStateCache = ComputeEditableState();
+
+		FGameSettingEditableState NewEditableState = ComputeEditableState();
+		const bool bEditableStateChanged = !NewEditableState.HasSameState(EditableStateCache);
+		EditableStateCache = MoveTemp(NewEditableState);
+
+		// Filters look at the editable state, so cached filter results are stale now
+		if (bEditableStateChanged && OwningRegistry)
+		{
+			OwningRegistry->InvalidateFilterCache();
+		}
 
 		if (bNotifyEditConditionsChanged)
 		{
-			NotifyEditConditionsChanged();
-		}		
+			// Only settings downstream of an actual change need to re-evaluate their own edit conditions.
+			if (bEditableStateChanged)
+			{
+				NotifyEditConditionsChanged();
+			}
+			else
+			{
+				BroadcastEditConditionsChanged();
+			}
+		}
 	}
 }
 
 void UGameSetting::NotifyEditConditionsChanged()
+{
+	BroadcastEditConditionsChanged();
+
+	MarkEditDependentsDirty(false);
+}
+
+void UGameSetting::BroadcastEditConditionsChanged()
 {
 	OnEditConditionsChanged();
 
@@ -254,20 +280,37 @@ void UGameSetting::OnEditConditionsChanged()
 
 }
 
-void UGameSetting::HandleEditDependencyChanged(UGameSetting* DependencySetting)
+void UGameSetting::HandleEditDependencyChanged(bool bDependencyValueChanged)
 {
 	OnDependencyChanged();
 	RefreshEditableState();
+
+	if (bDependencyValueChanged)
+	{
+		NotifySettingChanged(EGameSettingChangeReason::DependencyChanged);
+	}
 }
 
-void UGameSetting::HandleEditDependencyChanged(UGameSetting* DependencySetting, EGameSettingChangeReason Reason)
+void UGameSetting::MarkEditDependentsDirty(bool bValueChanged)
 {
-	OnDependencyChanged();
-	RefreshEditableState();
+	if (EditDependents.Num() == 0)
+	{
+		return;
+	}
 
-	if (Reason != EGameSettingChangeReason::DependencyChanged)
+	if (OwningRegistry)
 	{
-		NotifySettingChanged(EGameSettingChangeReason::DependencyChanged);
+		OwningRegistry->MarkEditDependentsDirty(this, bValueChanged);
+	}
+	else
+	{
+		for (const TWeakObjectPtr<UGameSetting>& WeakDependent : EditDependents)
+		{
+			if (UGameSetting* Dependent = WeakDependent.Get())
+			{
+				Dependent->HandleEditDependencyChanged(bValueChanged);
+			}
+		}
 	}
 }
 
@@ -40,11 +40,14 @@ void FGameSettingFilterState::AddSettingToRootList(UGameSetting* InSetting)
 {
 	SettingAllowList.Add(InSetting);
 	SettingRootList.Add(InSetting);
+	SettingAllowSet.Add(InSetting);
+	SettingRootSet.Add(InSetting);
 }
 
 void FGameSettingFilterState::AddSettingToAllowList(UGameSetting* InSetting)
 {
 	SettingAllowList.Add(InSetting);
+	SettingAllowSet.Add(InSetting);
 }
 
 void FGameSettingFilterState::SetSearchText(const FString& InSearchText)
@@ -52,6 +55,31 @@ void FGameSettingFilterState::SetSearchText(const FString& InSearchText)
 	SearchTextEvaluator.SetFilterText(FText::FromString(InSearchText));
 }
 
+bool FGameSettingFilterState::HasSameFilter(const FGameSettingFilterState& Other) const
+{
+	return bIncludeDisabled == Other.bIncludeDisabled
+		&& bIncludeHidden == Other.bIncludeHidden
+		&& bIncludeResetable == Other.bIncludeResetable
+		&& bIncludeNestedPages == Other.bIncludeNestedPages
+		&& SettingRootList == Other.SettingRootList
+		&& SettingAllowList == Other.SettingAllowList
+		&& SearchTextEvaluator.GetFilterText().ToString().Equals(Other.SearchTextEvaluator.GetFilterText().ToString(), ESearchCase::CaseSensitive);
+}
+
+uint32 FGameSettingFilterState::GetFilterHash() const
+{
+	uint32 Hash = (bIncludeDisabled ? 1 : 0) | (bIncludeHidden ? 2 : 0) | (bIncludeResetable ? 4 : 0) | (bIncludeNestedPages ? 8 : 0);
+	for (const UGameSetting* Setting : SettingRootList)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Setting));
+	}
+	for (const UGameSetting* Setting : SettingAllowList)
+	{
+		Hash = HashCombineFast(Hash, GetTypeHash(Setting));
+	}
+	return HashCombineFast(Hash, GetTypeHash(SearchTextEvaluator.GetFilterText().ToString()));
+}
+
 bool FGameSettingFilterState::DoesSettingPassFilter(const UGameSetting& InSetting) const
 {
 	const FGameSettingEditableState& EditableState = InSetting.GetEditState();
@@ -72,15 +100,15 @@ bool FGameSettingFilterState::DoesSettingPassFilter(const UGameSetting& InSettin
 	}
 
 	// Are we filtering settings?
-	if (SettingAllowList.Num() > 0)
+	if (SettingAllowSet.Num() > 0)
 	{
-		if (!SettingAllowList.Contains(&InSetting))
+		if (!SettingAllowSet.Contains(&InSetting))
 		{
 			bool bAllowed = false;
 			const UGameSetting* NextSetting = &InSetting;
 			while (const UGameSetting* Parent = NextSetting->GetSettingParent())
 			{
-				if (SettingAllowList.Contains(Parent))
+				if (SettingAllowSet.Contains(Parent))
 				{
 					bAllowed = true;
 					break;
@@ -148,5 +176,29 @@ void FGameSettingEditableState::UnableToReset()
 	bResetable = false;
 }
 
+bool FGameSettingEditableState::HasSameState(const FGameSettingEditableState& Other) const
+{
+	if (bVisible != Other.bVisible || bEnabled != Other.bEnabled || bResetable != Other.bResetable || bHideFromAnalytics != Other.bHideFromAnalytics)
+	{
+		return false;
+	}
+
+	if (DisabledOptions != Other.DisabledOptions || DisabledReasons.Num() != Other.DisabledReasons.Num())
+	{
+		return false;
+	}
+
+	for (int32 ReasonIndex = 0; ReasonIndex < DisabledReasons.Num(); ++ReasonIndex)
+	{
+		if (!DisabledReasons[ReasonIndex].EqualTo(Other.DisabledReasons[ReasonIndex]))
+		{
+			return false;
+		}
+	}
+
+	// Hidden reasons are developer-only and don't change how the setting is presented.
+	return true;
+}
+
 #undef LOCTEXT_NAMESPACE
 
@@ -33,7 +33,9 @@ void UGameSettingRegistry::Regenerate()
 		Setting->MarkAsGarbage();
 	}
 	RegisteredSettings.Reset();
+	RegisteredSettingsByDevName.Reset();
 	TopLevelSettings.Reset();
+	InvalidateFilterCache();
 
 	OnInitialize(OwningLocalPlayer);
 }
@@ -60,6 +62,30 @@ void UGameSettingRegistry::SaveChanges()
 
 void UGameSettingRegistry::GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings)
 {
+	// Number of distinct filters remembered, a screen typically uses one or two at a time.
+	static constexpr int32 MaxCachedFilterResults = 8;
+
+	const uint32 FilterHash = FilterState.GetFilterHash();
+	for (int32 CacheIndex = CachedFilterResults.Num() - 1; CacheIndex >= 0; --CacheIndex)
+	{
+		const FCachedFilterResult& Cached = CachedFilterResults[CacheIndex];
+		if (Cached.FilterHash == FilterHash && Cached.FilterState.HasSameFilter(FilterState))
+		{
+			InOutSettings.Append(Cached.Settings);
+			return;
+		}
+	}
+
+	if (CachedFilterResults.Num() >= MaxCachedFilterResults)
+	{
+		CachedFilterResults.RemoveAt(0);
+	}
+
+	FCachedFilterResult& NewResult = CachedFilterResults.AddDefaulted_GetRef();
+	NewResult.FilterHash = FilterHash;
+	NewResult.FilterState = FilterState;
+
+	TArray<UGameSetting*>& FilteredSettings = NewResult.Settings;
 	TArray<UGameSetting*> RootSettings;
 	if (FilterState.GetSettingRootList().Num() > 0)
 	{
@@ -74,29 +100,74 @@ void UGameSettingRegistry::GetSettingsForFilter(const FGameSettingFilterState& F
 	{
 		if (const UGameSettingCollection* TopLevelCollection = Cast<UGameSettingCollection>(TopLevelSetting))
 		{
-			TopLevelCollection->GetSettingsForFilter(FilterState, InOutSettings);
+			TopLevelCollection->GetSettingsForFilter(FilterState, FilteredSettings);
 		}
 		else
 		{
 			if (FilterState.DoesSettingPassFilter(*TopLevelSetting))
 			{
-				InOutSettings.Add(TopLevelSetting);
+				FilteredSettings.Add(TopLevelSetting);
 			}
 		}
 	}
+
+	InOutSettings.Append(FilteredSettings);
+}
+
+void UGameSettingRegistry::InvalidateFilterCache()
+{
+	CachedFilterResults.Reset();
 }
 
 UGameSetting* UGameSettingRegistry::FindSettingByDevName(const FName& SettingDevName)
 {
-	for (UGameSetting* Setting : RegisteredSettings)
+	const TObjectPtr<UGameSetting>* Setting = RegisteredSettingsByDevName.Find(SettingDevName);
+	return Setting ? Setting->Get() : nullptr;
+}
+
+void UGameSettingRegistry::MarkEditDependentsDirty(UGameSetting* ChangedSetting, bool bValueChanged)
+{
+	// Setting evaluations allowed per propagation, so dependency cycles (e.g. presets <-> individual options) settle.
+	static constexpr int32 MaxEvaluationsPerPropagation = 2;
+
+	for (const TWeakObjectPtr<UGameSetting>& WeakDependent : ChangedSetting->GetEditDependents())
 	{
-		if (Setting->GetDevName() == SettingDevName)
+		UGameSetting* Dependent = WeakDependent.Get();
+		if (Dependent == nullptr)
+		{
+			continue;
+		}
+
+		if (const int32* DirtyIndex = DirtyEditDependentIndices.Find(Dependent))
 		{
-			return Setting;
+			DirtyEditDependents[*DirtyIndex].bDependencyValueChanged |= bValueChanged;
+		}
+		else if (EditDependentEvaluationCounts.FindRef(Dependent) < MaxEvaluationsPerPropagation)
+		{
+			DirtyEditDependentIndices.Add(Dependent, DirtyEditDependents.Add({ Dependent, bValueChanged }));
 		}
 	}
 
-	return nullptr;
+	// If we're already propagating, the loop below picks them up.
+	if (bPropagatingEditDependencies)
+	{
+		return;
+	}
+
+	TGuardValue<bool> Guard(bPropagatingEditDependencies, true);
+
+	for (int32 DirtyIndex = 0; DirtyIndex < DirtyEditDependents.Num(); ++DirtyIndex)
+	{
+		const FDirtyEditDependent DirtyDependent = DirtyEditDependents[DirtyIndex];
+		DirtyEditDependentIndices.Remove(DirtyDependent.Setting);
+		EditDependentEvaluationCounts.FindOrAdd(DirtyDependent.Setting)++;
+
+		DirtyDependent.Setting->HandleEditDependencyChanged(DirtyDependent.bDependencyValueChanged);
+	}
+
+	DirtyEditDependents.Reset();
+	DirtyEditDependentIndices.Reset();
+	EditDependentEvaluationCounts.Reset();
 }
 
 void UGameSettingRegistry::RegisterSetting(UGameSetting* InSetting)
@@ -111,6 +182,8 @@ void UGameSettingRegistry::RegisterSetting(UGameSetting* InSetting)
 
 void UGameSettingRegistry::RegisterInnerSettings(UGameSetting* InSetting)
 {
+	InSetting->SetRegistry(this);
+
 	InSetting->OnSettingChangedEvent.AddUObject(this, &ThisClass::HandleSettingChanged);
 	InSetting->OnSettingAppliedEvent.AddUObject(this, &ThisClass::HandleSettingApplied);
 	InSetting->OnSettingEditConditionChangedEvent.AddUObject(this, &ThisClass::HandleSettingEditConditionsChanged);
@@ -128,10 +201,12 @@ void UGameSettingRegistry::RegisterInnerSettings(UGameSetting* InSetting)
 
 #if !UE_BUILD_SHIPPING
 	ensureAlwaysMsgf(!RegisteredSettings.Contains(InSetting), TEXT("This setting has already been registered!"));
-	ensureAlwaysMsgf(nullptr == RegisteredSettings.FindByPredicate([&InSetting](UGameSetting* ExistingSetting) { return InSetting->GetDevName() == ExistingSetting->GetDevName(); }), TEXT("A setting with this DevName has already been registered!  DevNames must be unique within a registry."));
+	ensureAlwaysMsgf(!RegisteredSettingsByDevName.Contains(InSetting->GetDevName()), TEXT("A setting with this DevName has already been registered!  DevNames must be unique within a registry."));
 #endif
 
 	RegisteredSettings.Add(InSetting);
+	RegisteredSettingsByDevName.FindOrAdd(InSetting->GetDevName(), InSetting);
+	InvalidateFilterCache();
 
 	for (UGameSetting* ChildSetting : InSetting->GetChildSettings())
 	{
@@ -146,6 +221,9 @@ void UGameSettingRegistry::HandleSettingApplied(UGameSetting* Setting)
 
 void UGameSettingRegistry::HandleSettingChanged(UGameSetting* Setting, EGameSettingChangeReason Reason)
 {
+	// Descriptions may depend on the value, and the search text filter looks at them
+	InvalidateFilterCache();
+
 	OnSettingChangedEvent.Broadcast(Setting, Reason);
 }
 
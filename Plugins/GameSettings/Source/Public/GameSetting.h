@@ -114,6 +114,9 @@ public:
 	/** Add setting dependency, if these settings change, we'll re-evaluate edit conditions for this setting. */
 	void AddEditDependency(UGameSetting* DependencySetting);
 
+	/** Gets the settings that re-evaluate their edit conditions when this setting changes. */
+	const TArray<TWeakObjectPtr<UGameSetting>>& GetEditDependents() const { return EditDependents; }
+
 	/** The parent object that owns the setting, in most cases the collection, but for top level settings the registry. */
 	void SetSettingParent(UGameSetting* InSettingParent);
 	UGameSetting* GetSettingParent() const { return SettingParent; }
@@ -168,9 +171,11 @@ protected:
 	/**  */
 	virtual FText GetDynamicDetailsInternal() const;
 
-	/** */
-	void HandleEditDependencyChanged(UGameSetting* DependencySetting, EGameSettingChangeReason Reason);
-	void HandleEditDependencyChanged(UGameSetting* DependencySetting);
+	/** Called when one of our edit dependencies changed, either its value or just its edit conditions. */
+	void HandleEditDependencyChanged(bool bDependencyValueChanged);
+
+	/** Lets our edit dependents know they need to re-evaluate, batched through the registry when we have one. */
+	void MarkEditDependentsDirty(bool bValueChanged);
 
 	/** Regenerates the plain searchable text if it has been dirtied. */
 	void RefreshPlainText() const;
@@ -184,6 +189,9 @@ protected:
 	void NotifyEditConditionsChanged();
 	virtual void OnEditConditionsChanged();
 
+	/** Tells listeners the edit conditions were re-evaluated, without making our edit dependents re-evaluate. */
+	void BroadcastEditConditionsChanged();
+
 	/**  */
 	FGameSettingEditableState ComputeEditableState() const;
 
@@ -250,4 +258,9 @@ private:
 
 	/** We cache the editable state of a setting when it changes rather than reprocessing it any time it's needed.  */
 	FGameSettingEditableState EditableStateCache;
+
+	/** Settings that added us as an edit dependency. */
+	TArray<TWeakObjectPtr<UGameSetting>> EditDependents;
+
+	friend class UGameSettingRegistry;
 };
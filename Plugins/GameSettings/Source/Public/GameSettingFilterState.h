@@ -54,15 +54,21 @@ public:
 
 	bool IsSettingInAllowList(const UGameSetting* InSetting) const
 	{
-		return SettingAllowList.Contains(InSetting);
+		return SettingAllowSet.Contains(InSetting);
 	}
 	
 	const TArray<UGameSetting*>& GetSettingRootList() const { return SettingRootList; }
 	bool IsSettingInRootList(const UGameSetting* InSetting) const
 	{
-		return SettingRootList.Contains(InSetting);
+		return SettingRootSet.Contains(InSetting);
 	}
 
+	/** Returns true if both filters would let the same settings through, used to reuse cached filter results. */
+	bool HasSameFilter(const FGameSettingFilterState& Other) const;
+
+	/** Hash of everything HasSameFilter compares. */
+	uint32 GetFilterHash() const;
+
 private:
 	FTextFilterExpressionEvaluator SearchTextEvaluator;
 
@@ -72,6 +78,10 @@ private:
 	// If this is non-empty, then only settings in here are allowed
 	UPROPERTY()
 	TArray<TObjectPtr<UGameSetting>> SettingAllowList;
+
+	// Hashed copies of the lists above, filters are run against every setting in the tree
+	TSet<const UGameSetting*> SettingRootSet;
+	TSet<const UGameSetting*> SettingAllowSet;
 };
 
 /**
@@ -101,6 +111,9 @@ public:
 
 	const TArray<FString>& GetDisabledOptions() const { return DisabledOptions; }
 
+	/** Returns true if both states present the setting the same way to the player. */
+	bool HasSameState(const FGameSettingEditableState& Other) const;
+
 	/** Hides the setting, you don't have to provide a user facing reason, but you do need to specify a developer reason. */
 	void Hide(const FString& DevReason);
 
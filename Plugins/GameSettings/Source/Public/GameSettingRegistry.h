@@ -3,6 +3,7 @@
 #pragma once
 
 #include "GameSetting.h"
+#include "GameSettingFilterState.h"
 #include "Templates/Casts.h"
 
 #include "GameSettingRegistry.generated.h"
@@ -51,8 +52,15 @@ public:
 
 	virtual void SaveChanges();
 	
+	/**
+	 * Appends the settings that pass the filter. Results are cached per filter until the editable state of a setting
+	 * changes (or a setting changes, as that may change its description), so repeated refreshes don't walk the tree.
+	 */
 	void GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings);
 
+	/** Drops the cached filter results, called when anything a filter looks at may have changed. */
+	void InvalidateFilterCache();
+
 	UGameSetting* FindSettingByDevName(const FName& SettingDevName);
 
 	template<typename T = UGameSetting>
@@ -63,6 +71,12 @@ public:
 		return Setting;
 	}
 
+	/**
+	 * Queues the edit dependents of ChangedSetting to re-evaluate their edit conditions.  Everything downstream of
+	 * the change is processed in one pass, with each setting evaluated once (twice at most for dependency cycles).
+	 */
+	void MarkEditDependentsDirty(UGameSetting* ChangedSetting, bool bValueChanged);
+
 protected:
 	virtual void OnInitialize(ULocalPlayer* InLocalPlayer) PURE_VIRTUAL(, )
 
@@ -84,6 +98,35 @@ protected:
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UGameSetting>> RegisteredSettings;
 
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<UGameSetting>> RegisteredSettingsByDevName;
+
 	UPROPERTY(Transient)
 	TObjectPtr<ULocalPlayer> OwningLocalPlayer;
+
+private:
+	struct FCachedFilterResult
+	{
+		uint32 FilterHash = 0;
+		FGameSettingFilterState FilterState;
+		TArray<UGameSetting*> Settings;
+	};
+
+	/** Recently used filter results, most recent last. Settings are kept alive by RegisteredSettings. */
+	TArray<FCachedFilterResult> CachedFilterResults;
+
+	struct FDirtyEditDependent
+	{
+		UGameSetting* Setting = nullptr;
+		bool bDependencyValueChanged = false;
+	};
+
+	/** Settings waiting to re-evaluate their edit conditions during the current propagation. */
+	TArray<FDirtyEditDependent> DirtyEditDependents;
+	TMap<UGameSetting*, int32> DirtyEditDependentIndices;
+
+	/** How many times each setting has been evaluated during the current propagation. */
+	TMap<UGameSetting*, int32> EditDependentEvaluationCounts;
+
+	bool bPropagatingEditDependencies = false;
 };
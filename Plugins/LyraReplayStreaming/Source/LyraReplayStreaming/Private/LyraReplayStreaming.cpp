@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraReplayStreaming.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/Compression.h"
+#include "Modules/ModuleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLyraReplayStreaming, Log, All);
+
+namespace LyraReplayStreaming
+{
+	static FString CompressionFormat = TEXT("Oodle");
+	static FAutoConsoleVariableRef CVarCompressionFormat(TEXT("Lyra.ReplayStreaming.CompressionFormat"), CompressionFormat, TEXT("Compression format used for new replay chunks, the format is stored in every chunk so existing replays still load after changing it"), ECVF_Default);
+}
+
+// Every chunk starts with a small header so it can be decompressed without any outside state
+struct FLyraCompressedReplayChunkHeader
+{
+	FName Format;
+	int32 UncompressedSize = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FLyraCompressedReplayChunkHeader& Header)
+	{
+		return Ar << Header.Format << Header.UncompressedSize;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////
+// FLyraCompressedReplayStreamer
+
+bool FLyraCompressedReplayStreamer::CompressBuffer(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FLyraCompressedReplayStreamer::CompressBuffer);
+
+	FLyraCompressedReplayChunkHeader Header;
+	Header.Format = FName(*LyraReplayStreaming::CompressionFormat);
+	Header.UncompressedSize = InBuffer.Num();
+
+	OutCompressed.Reset();
+	FMemoryWriter HeaderWriter(OutCompressed);
+	HeaderWriter << Header;
+	const int32 HeaderSize = OutCompressed.Num();
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(Header.Format, Header.UncompressedSize);
+	OutCompressed.AddUninitialized(CompressedSize);
+
+	if (!FCompression::CompressMemory(Header.Format, OutCompressed.GetData() + HeaderSize, CompressedSize, InBuffer.GetData(), Header.UncompressedSize))
+	{
+		UE_LOG(LogLyraReplayStreaming, Error, TEXT("Failed to compress a %d byte replay chunk with %s"), Header.UncompressedSize, *Header.Format.ToString());
+		return false;
+	}
+
+	OutCompressed.SetNum(HeaderSize + CompressedSize, EAllowShrinking::No);
+	return true;
+}
+
+bool FLyraCompressedReplayStreamer::DecompressBuffer(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FLyraCompressedReplayStreamer::DecompressBuffer);
+
+	FLyraCompressedReplayChunkHeader Header;
+	FMemoryReader HeaderReader(InCompressed);
+	HeaderReader << Header;
+
+	if (HeaderReader.IsError() || (Header.UncompressedSize < 0))
+	{
+		UE_LOG(LogLyraReplayStreaming, Error, TEXT("Replay chunk has an invalid compression header"));
+		return false;
+	}
+
+	const int32 HeaderSize = static_cast<int32>(HeaderReader.Tell());
+
+	OutBuffer.SetNumUninitialized(Header.UncompressedSize);
+	if (!FCompression::UncompressMemory(Header.Format, OutBuffer.GetData(), Header.UncompressedSize, InCompressed.GetData() + HeaderSize, InCompressed.Num() - HeaderSize))
+	{
+		UE_LOG(LogLyraReplayStreaming, Error, TEXT("Failed to decompress a %d byte replay chunk with %s"), Header.UncompressedSize, *Header.Format.ToString());
+		return false;
+	}
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraCompressedReplayStreamingFactory
+
+TSharedPtr<INetworkReplayStreamer> FLyraCompressedReplayStreamingFactory::CreateReplayStreamer()
+{
+	// The base factory ticks every streamer it owns
+	TSharedPtr<FLyraCompressedReplayStreamer> Streamer = MakeShared<FLyraCompressedReplayStreamer>();
+	LocalFileStreamers.Add(Streamer);
+	return Streamer;
+}
+
+IMPLEMENT_MODULE(FLyraCompressedReplayStreamingFactory, LyraReplayStreaming)
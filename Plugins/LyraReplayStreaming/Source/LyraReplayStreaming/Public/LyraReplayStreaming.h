@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "LocalFileNetworkReplayStreaming.h"
+
+/**
+ * Local file replay streamer which compresses every chunk it writes.
+ *
+ * The local file streamer already buffers the stream in memory only until the next chunk flush and
+ * performs the flush from its file request queue on the thread pool, so the compression below runs
+ * off the game thread and the memory held by a recording stays bounded by one chunk.
+ *
+ * Select it by recording with the "ReplayStreamerOverride=LyraReplayStreaming" option.
+ */
+class LYRAREPLAYSTREAMING_API FLyraCompressedReplayStreamer : public FLocalFileNetworkReplayStreamer
+{
+public:
+	FLyraCompressedReplayStreamer() = default;
+	explicit FLyraCompressedReplayStreamer(const FString& DemoSavePath) : FLocalFileNetworkReplayStreamer(DemoSavePath) {}
+
+	//~FLocalFileNetworkReplayStreamer interface
+	virtual bool SupportsCompression() const override { return true; }
+	virtual bool CompressBuffer(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed) const override;
+	virtual bool DecompressBuffer(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer) const override;
+	//~End of FLocalFileNetworkReplayStreamer interface
+};
+
+class LYRAREPLAYSTREAMING_API FLyraCompressedReplayStreamingFactory : public FLocalFileNetworkReplayStreamingFactory
+{
+public:
+	//~INetworkReplayStreamingFactory interface
+	virtual TSharedPtr<INetworkReplayStreamer> CreateReplayStreamer() override;
+	//~End of INetworkReplayStreamingFactory interface
+};
@@ -35,6 +35,13 @@ namespace LyraGameplayCueManagerCvars
 		FConsoleCommandWithArgsDelegate::CreateStatic(ULyraGameplayCueManager::DumpGameplayCues));
 
 	static ELyraEditorLoadMode LoadMode = ELyraEditorLoadMode::LoadUpfront;
+
+	static int32 MaxLoadedTagsToProcessPerFrame = 256;
+	static FAutoConsoleVariableRef CVarMaxLoadedTagsToProcessPerFrame(
+		TEXT("Lyra.GameplayCues.MaxLoadedTagsToProcessPerFrame"),
+		MaxLoadedTagsToProcessPerFrame,
+		TEXT("Maximum number of loaded gameplay tags examined for cue preloading per frame (<= 0 means unlimited)."),
+		ECVF_Default);
 }
 
 const bool bPreloadEvenInEditor = true;
@@ -179,12 +186,12 @@ void ULyraGameplayCueManager::DumpGameplayCues(const TArray<FString>& Args)
 
 void ULyraGameplayCueManager::OnGameplayTagLoaded(const FGameplayTag& Tag)
 {
-	FScopeLock ScopeLock(&LoadedGameplayTagsToProcessCS);
-	bool bStartTask = LoadedGameplayTagsToProcess.Num() == 0;
+	// This can be called from async loading threads, so only touch the lock-free queue and the scheduling flag here
 	FUObjectSerializeContext* LoadContext = FUObjectThreadContext::Get().GetSerializeContext();
 	UObject* OwningObject = LoadContext ? LoadContext->SerializedObject : nullptr;
-	LoadedGameplayTagsToProcess.Emplace(Tag, OwningObject);
-	if (bStartTask)
+	LoadedGameplayTagsToProcess.Enqueue(FLoadedGameplayTagToProcessData(Tag, OwningObject));
+
+	if (!bLoadedTagProcessingScheduled.exchange(true))
 	{
 		TGraphTask<FGameplayCueTagThreadSynchronizeGraphTask>::CreateTask().ConstructAndDispatchWhenReady([]()
 			{
@@ -216,37 +223,93 @@ void ULyraGameplayCueManager::HandlePostGarbageCollect()
 	bProcessLoadedTagsAfterGC = false;
 }
 
+void ULyraGameplayCueManager::ScheduleProcessLoadedTags()
+{
+	if (!ProcessLoadedTagsTickHandle.IsValid())
+	{
+		ProcessLoadedTagsTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::HandleProcessLoadedTagsTick));
+	}
+}
+
+bool ULyraGameplayCueManager::HandleProcessLoadedTagsTick(float DeltaTime)
+{
+	ProcessLoadedTagsTickHandle.Reset();
+
+	if (IsGarbageCollecting())
+	{
+		bProcessLoadedTagsAfterGC = true;
+	}
+	else
+	{
+		ProcessLoadedTags();
+	}
+
+	// One-shot, ProcessLoadedTags will reschedule if there is still work left
+	return false;
+}
+
 void ULyraGameplayCueManager::ProcessLoadedTags()
 {
-	TArray<FLoadedGameplayTagToProcessData> TaskLoadedGameplayTagsToProcess;
+	check(IsInGameThread());
+
+	// This might return during shutdown, and we don't want to proceed if that is the case
+	if (!GIsRunning)
 	{
-		// Lock LoadedGameplayTagsToProcess just long enough to make a copy and clear
-		FScopeLock TaskScopeLock(&LoadedGameplayTagsToProcessCS);
-		TaskLoadedGameplayTagsToProcess = LoadedGameplayTagsToProcess;
 		LoadedGameplayTagsToProcess.Empty();
+		LoadedTagsBeingProcessed.Reset();
+		bLoadedTagProcessingScheduled = false;
+		return;
 	}
 
-	// This might return during shutdown, and we don't want to proceed if that is the case
-	if (GIsRunning)
+	const int32 MaxToProcess = LyraGameplayCueManagerCvars::MaxLoadedTagsToProcessPerFrame;
+	int32 NumProcessed = 0;
+
+	FLoadedGameplayTagToProcessData LoadedTagData;
+	while (((MaxToProcess <= 0) || (NumProcessed < MaxToProcess)) && LoadedGameplayTagsToProcess.Dequeue(LoadedTagData))
 	{
-		if (RuntimeGameplayCueObjectLibrary.CueSet)
+		++NumProcessed;
+
+		if (!RuntimeGameplayCueObjectLibrary.CueSet)
 		{
-			for (const FLoadedGameplayTagToProcessData& LoadedTagData : TaskLoadedGameplayTagsToProcess)
-			{
-				if (RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueDataMap.Contains(LoadedTagData.Tag))
-				{
-					if (!LoadedTagData.WeakOwner.IsStale())
-					{
-						ProcessTagToPreload(LoadedTagData.Tag, LoadedTagData.WeakOwner.Get());
-					}
-				}
-			}
+			UE_LOG(LogLyra, Warning, TEXT("ULyraGameplayCueManager::OnGameplayTagLoaded processed loaded tag(s) but RuntimeGameplayCueObjectLibrary.CueSet was null. Skipping processing."));
+			LoadedGameplayTagsToProcess.Empty();
+			break;
 		}
-		else
+
+		if (LoadedTagData.WeakOwner.IsStale())
 		{
-			UE_LOG(LogLyra, Warning, TEXT("ULyraGameplayCueManager::OnGameplayTagLoaded processed loaded tag(s) but RuntimeGameplayCueObjectLibrary.CueSet was null. Skipping processing."));
+			continue;
+		}
+
+		UObject* OwningObject = LoadedTagData.WeakOwner.Get();
+		bool bAlreadyProcessing = false;
+		LoadedTagsBeingProcessed.Add(TPair<FGameplayTag, FObjectKey>(LoadedTagData.Tag, FObjectKey(OwningObject)), &bAlreadyProcessing);
+		if (bAlreadyProcessing)
+		{
+			continue;
+		}
+
+		if (RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueDataMap.Contains(LoadedTagData.Tag))
+		{
+			ProcessTagToPreload(LoadedTagData.Tag, OwningObject);
 		}
 	}
+
+	if (!LoadedGameplayTagsToProcess.IsEmpty())
+	{
+		// Out of budget for this frame, continue next frame
+		ScheduleProcessLoadedTags();
+		return;
+	}
+
+	LoadedTagsBeingProcessed.Reset();
+	bLoadedTagProcessingScheduled = false;
+
+	// A producer may have enqueued after the queue drained but before the flag was cleared, in which case it would not have scheduled processing itself
+	if (!LoadedGameplayTagsToProcess.IsEmpty() && !bLoadedTagProcessingScheduled.exchange(true))
+	{
+		ScheduleProcessLoadedTags();
+	}
 }
 
 void ULyraGameplayCueManager::ProcessTagToPreload(const FGameplayTag& Tag, UObject* OwningObject)
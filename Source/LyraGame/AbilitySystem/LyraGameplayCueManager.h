@@ -3,6 +3,11 @@
 #pragma once
 
 #include "GameplayCueManager.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+
+#include <atomic>
 
 #include "LyraGameplayCueManager.generated.h"
 
@@ -10,7 +15,6 @@ class FString;
 class UClass;
 class UObject;
 class UWorld;
-struct FObjectKey;
 
 /**
  * ULyraGameplayCueManager
@@ -46,6 +50,8 @@ private:
 	void OnGameplayTagLoaded(const FGameplayTag& Tag);
 	void HandlePostGarbageCollect();
 	void ProcessLoadedTags();
+	void ScheduleProcessLoadedTags();
+	bool HandleProcessLoadedTagsTick(float DeltaTime);
 	void ProcessTagToPreload(const FGameplayTag& Tag, UObject* OwningObject);
 	void OnPreloadCueComplete(FSoftObjectPath Path, TWeakObjectPtr<UObject> OwningObject, bool bAlwaysLoadedCue);
 	void RegisterPreloadedCue(UClass* LoadedGameplayCueClass, UObject* OwningObject);
@@ -73,7 +79,15 @@ private:
 	UPROPERTY(transient)
 	TSet<TObjectPtr<UClass>> AlwaysLoadedCues;
 
-	TArray<FLoadedGameplayTagToProcessData> LoadedGameplayTagsToProcess;
-	FCriticalSection LoadedGameplayTagsToProcessCS;
+	// Tags pushed from (possibly) async loading threads, drained on the game thread with a per-frame budget
+	TQueue<FLoadedGameplayTagToProcessData, EQueueMode::Mpsc> LoadedGameplayTagsToProcess;
+
+	// Set by the first producer that finds the queue idle, cleared by the game thread once the queue is fully drained
+	std::atomic<bool> bLoadedTagProcessingScheduled{ false };
+
+	// Tag/owner pairs already processed since the queue was last empty, used to skip duplicates during map loads
+	TSet<TPair<FGameplayTag, FObjectKey>> LoadedTagsBeingProcessed;
+
+	FTSTicker::FDelegateHandle ProcessLoadedTagsTickHandle;
 	bool bProcessLoadedTagsAfterGC = false;
 };
@@ -52,14 +52,47 @@ void ULyraAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
 	Super::NativeUpdateAnimation(DeltaSeconds);
 
+	GatherCharacterState();
+}
+
+void ULyraAnimInstance::GatherCharacterState()
+{
+	FLyraAnimCharacterState& State = GameThreadCharacterState;
+
 	const ALyraCharacter* Character = Cast<ALyraCharacter>(GetOwningActor());
 	if (!Character)
 	{
+		State = FLyraAnimCharacterState();
 		return;
 	}
 
+	// Ground info may need to trace, so it has to be gathered here rather than on the worker thread
 	ULyraCharacterMovementComponent* CharMoveComp = CastChecked<ULyraCharacterMovementComponent>(Character->GetCharacterMovement());
 	const FLyraCharacterGroundInfo& GroundInfo = CharMoveComp->GetGroundInfo();
-	GroundDistance = GroundInfo.GroundDistance;
+
+	State.WorldLocation = Character->GetActorLocation();
+	State.WorldRotation = Character->GetActorRotation();
+	State.WorldVelocity = CharMoveComp->Velocity;
+	State.WorldAcceleration = CharMoveComp->GetCurrentAcceleration();
+	State.GroundDistance = GroundInfo.GroundDistance;
+	State.GravityZ = CharMoveComp->GetGravityZ();
+	State.MovementMode = CharMoveComp->MovementMode;
+	State.bIsOnGround = CharMoveComp->IsMovingOnGround();
+	State.bIsFalling = CharMoveComp->IsFalling();
+	State.bIsCrouching = CharMoveComp->IsCrouching();
+	State.bIsValid = true;
 }
 
+void ULyraAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	CharacterState = GameThreadCharacterState;
+
+	if (CharacterState.bIsValid)
+	{
+		GroundDistance = CharacterState.GroundDistance;
+		GroundSpeed = CharacterState.WorldVelocity.Size2D();
+		bHasAcceleration = !FMath::IsNearlyZero(CharacterState.WorldAcceleration.SizeSquared2D());
+	}
+}
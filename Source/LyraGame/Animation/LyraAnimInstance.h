@@ -3,12 +3,59 @@
 #pragma once
 
 #include "Animation/AnimInstance.h"
+#include "Engine/EngineTypes.h"
 #include "GameplayEffectTypes.h"
 #include "LyraAnimInstance.generated.h"
 
 class UAbilitySystemComponent;
 
 
+/**
+ * FLyraAnimCharacterState
+ *
+ *	Character and movement state gathered once per frame on the game thread, so the animation update can run on a worker thread.
+ */
+USTRUCT(BlueprintType)
+struct FLyraAnimCharacterState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	FVector WorldLocation = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	FRotator WorldRotation = FRotator::ZeroRotator;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	FVector WorldVelocity = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	FVector WorldAcceleration = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	float GroundDistance = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	float GravityZ = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	TEnumAsByte<EMovementMode> MovementMode = MOVE_None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	bool bIsOnGround = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	bool bIsFalling = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	bool bIsCrouching = false;
+
+	// False when the owner is not a Lyra character, in which case the other values are defaults
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	bool bIsValid = false;
+};
+
+
 /**
  * ULyraAnimInstance
  *
@@ -33,6 +80,10 @@ protected:
 
 	virtual void NativeInitializeAnimation() override;
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+	// Reads the owning character on the game thread, the result is consumed by NativeThreadSafeUpdateAnimation.
+	void GatherCharacterState();
 
 protected:
 
@@ -41,6 +92,21 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "GameplayTags")
 	FGameplayTagBlueprintPropertyMap GameplayTagPropertyMap;
 
+	// Character state for this frame.  Only written during the thread safe update so graphs can use fast path property access on worker threads.
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	FLyraAnimCharacterState CharacterState;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
 	float GroundDistance = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	float GroundSpeed = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
+	bool bHasAcceleration = false;
+
+private:
+
+	// Written on the game thread in NativeUpdateAnimation and copied into CharacterState by the worker thread update that follows it
+	FLyraAnimCharacterState GameThreadCharacterState;
 };
@@ -3,8 +3,10 @@
 
 #include "Audio/LyraAudioMixEffectsSubsystem.h"
 
+#include "AudioDevice.h"
 #include "AudioMixerBlueprintLibrary.h"
 #include "AudioModulationStatics.h"
+#include "Engine/AssetManager.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "LoadingScreenManager.h"
@@ -18,6 +20,45 @@
 
 class FSubsystemCollectionBase;
 
+namespace LyraAudioMixEffects
+{
+	template<typename AssetType>
+	AssetType* ResolveLoadedAsset(const FSoftObjectPath& AssetPath, const TCHAR* DebugName)
+	{
+		if (UObject* LoadedObject = AssetPath.ResolveObject())
+		{
+			AssetType* Asset = Cast<AssetType>(LoadedObject);
+			ensureMsgf(Asset, TEXT("%s reference missing from Lyra Audio Settings."), DebugName);
+			return Asset;
+		}
+
+		return nullptr;
+	}
+
+	static void ResolveSubmixEffectChains(const TArray<FLyraSubmixEffectChainMap>& SoftEffectChains, TArray<FLyraAudioSubmixEffectsChain>& OutEffectChains)
+	{
+		OutEffectChains.Reset(SoftEffectChains.Num());
+
+		for (const FLyraSubmixEffectChainMap& SoftSubmixEffectChain : SoftEffectChains)
+		{
+			FLyraAudioSubmixEffectsChain& NewEffectChain = OutEffectChains.AddDefaulted_GetRef();
+
+			if (USoundSubmix* Submix = SoftSubmixEffectChain.Submix.Get())
+			{
+				NewEffectChain.Submix = Submix;
+
+				for (const TSoftObjectPtr<USoundEffectSubmixPreset>& SoftEffect : SoftSubmixEffectChain.SubmixEffectChain)
+				{
+					if (USoundEffectSubmixPreset* SubmixPreset = SoftEffect.Get())
+					{
+						NewEffectChain.SubmixEffectChain.Add(SubmixPreset);
+					}
+				}
+			}
+		}
+	}
+}
+
 void ULyraAudioMixEffectsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -25,6 +66,14 @@ void ULyraAudioMixEffectsSubsystem::Initialize(FSubsystemCollectionBase& Collect
 
 void ULyraAudioMixEffectsSubsystem::Deinitialize()
 {
+	if (AudioAssetsLoadHandle.IsValid())
+	{
+		AudioAssetsLoadHandle->CancelHandle();
+		AudioAssetsLoadHandle.Reset();
+	}
+
+	SetMutedUntilMixesApplied(false);
+
 	if (ULoadingScreenManager* LoadingScreenManager = UGameInstance::GetSubsystem<ULoadingScreenManager>(GetWorld()->GetGameInstance()))
 	{
 		LoadingScreenManager->OnLoadingScreenVisibilityChangedDelegate().RemoveAll(this);
@@ -51,176 +100,102 @@ bool ULyraAudioMixEffectsSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 
 void ULyraAudioMixEffectsSubsystem::PostInitialize()
 {
+	// Request every mix, bus, submix and effect preset as one batch so they stream in alongside the rest of world startup
 	if (const ULyraAudioSettings* LyraAudioSettings = GetDefault<ULyraAudioSettings>())
 	{
-		if (UObject* ObjPath = LyraAudioSettings->DefaultControlBusMix.TryLoad())
+		TArray<FSoftObjectPath> AssetsToLoad;
+		AssetsToLoad.Add(LyraAudioSettings->DefaultControlBusMix);
+		AssetsToLoad.Add(LyraAudioSettings->LoadingScreenControlBusMix);
+		AssetsToLoad.Add(LyraAudioSettings->UserSettingsControlBusMix);
+		AssetsToLoad.Add(LyraAudioSettings->OverallVolumeControlBus);
+		AssetsToLoad.Add(LyraAudioSettings->MusicVolumeControlBus);
+		AssetsToLoad.Add(LyraAudioSettings->SoundFXVolumeControlBus);
+		AssetsToLoad.Add(LyraAudioSettings->DialogueVolumeControlBus);
+		AssetsToLoad.Add(LyraAudioSettings->VoiceChatVolumeControlBus);
+
+		for (const TArray<FLyraSubmixEffectChainMap>* EffectChains : { &LyraAudioSettings->HDRAudioSubmixEffectChain, &LyraAudioSettings->LDRAudioSubmixEffectChain })
 		{
-			if (USoundControlBusMix* SoundControlBusMix = Cast<USoundControlBusMix>(ObjPath))
-			{
-				DefaultBaseMix = SoundControlBusMix;
-			}
-			else
-			{
-				ensureMsgf(SoundControlBusMix, TEXT("Default Control Bus Mix reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		if (UObject* ObjPath = LyraAudioSettings->LoadingScreenControlBusMix.TryLoad())
-		{
-			if (USoundControlBusMix* SoundControlBusMix = Cast<USoundControlBusMix>(ObjPath))
-			{
-				LoadingScreenMix = SoundControlBusMix;
-			}
-			else
+			for (const FLyraSubmixEffectChainMap& SoftSubmixEffectChain : *EffectChains)
 			{
-				ensureMsgf(SoundControlBusMix, TEXT("Loading Screen Control Bus Mix reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		if (UObject* ObjPath = LyraAudioSettings->UserSettingsControlBusMix.TryLoad())
-		{
-			if (USoundControlBusMix* SoundControlBusMix = Cast<USoundControlBusMix>(ObjPath))
-			{
-				UserMix = SoundControlBusMix;
-			}
-			else
-			{
-				ensureMsgf(SoundControlBusMix, TEXT("User Control Bus Mix reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		if (UObject* ObjPath = LyraAudioSettings->OverallVolumeControlBus.TryLoad())
-		{
-			if (USoundControlBus* SoundControlBus = Cast<USoundControlBus>(ObjPath))
-			{
-				OverallControlBus = SoundControlBus;
-			}
-			else
-			{
-				ensureMsgf(SoundControlBus, TEXT("Overall Control Bus reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		if (UObject* ObjPath = LyraAudioSettings->MusicVolumeControlBus.TryLoad())
-		{
-			if (USoundControlBus* SoundControlBus = Cast<USoundControlBus>(ObjPath))
-			{
-				MusicControlBus = SoundControlBus;
-			}
-			else
-			{
-				ensureMsgf(SoundControlBus, TEXT("Music Control Bus reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		if (UObject* ObjPath = LyraAudioSettings->SoundFXVolumeControlBus.TryLoad())
-		{
-			if (USoundControlBus* SoundControlBus = Cast<USoundControlBus>(ObjPath))
-			{
-				SoundFXControlBus = SoundControlBus;
-			}
-			else
-			{
-				ensureMsgf(SoundControlBus, TEXT("SoundFX Control Bus reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		if (UObject* ObjPath = LyraAudioSettings->DialogueVolumeControlBus.TryLoad())
-		{
-			if (USoundControlBus* SoundControlBus = Cast<USoundControlBus>(ObjPath))
-			{
-				DialogueControlBus = SoundControlBus;
-			}
-			else
-			{
-				ensureMsgf(SoundControlBus, TEXT("Dialogue Control Bus reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		if (UObject* ObjPath = LyraAudioSettings->VoiceChatVolumeControlBus.TryLoad())
-		{
-			if (USoundControlBus* SoundControlBus = Cast<USoundControlBus>(ObjPath))
-			{
-				VoiceChatControlBus = SoundControlBus;
-			}
-			else
-			{
-				ensureMsgf(SoundControlBus, TEXT("VoiceChat Control Bus reference missing from Lyra Audio Settings."));
-			}
-		}
-
-		// Load HDR Submix Effect Chain
-		for (const FLyraSubmixEffectChainMap& SoftSubmixEffectChain : LyraAudioSettings->HDRAudioSubmixEffectChain)
-		{
-			FLyraAudioSubmixEffectsChain NewEffectChain;
-
-			if (UObject* SubmixObjPath = SoftSubmixEffectChain.Submix.LoadSynchronous())
-			{
-				if (USoundSubmix* Submix = Cast<USoundSubmix>(SubmixObjPath))
+				AssetsToLoad.Add(SoftSubmixEffectChain.Submix.ToSoftObjectPath());
+				for (const TSoftObjectPtr<USoundEffectSubmixPreset>& SoftEffect : SoftSubmixEffectChain.SubmixEffectChain)
 				{
-					NewEffectChain.Submix = Submix;
-					TArray<USoundEffectSubmixPreset*> NewPresetChain;
-
-					for (const TSoftObjectPtr<USoundEffectSubmixPreset>& SoftEffect : SoftSubmixEffectChain.SubmixEffectChain)
-					{
-						if (UObject* EffectObjPath = SoftEffect.LoadSynchronous())
-						{
-							if (USoundEffectSubmixPreset* SubmixPreset = Cast<USoundEffectSubmixPreset>(EffectObjPath))
-							{
-								NewPresetChain.Add(SubmixPreset);
-							}
-						}
-					}
-
-					NewEffectChain.SubmixEffectChain.Append(NewPresetChain);
+					AssetsToLoad.Add(SoftEffect.ToSoftObjectPath());
 				}
 			}
-
-			HDRSubmixEffectChain.Add(NewEffectChain);
 		}
 
-		// Load LDR Submix Effect Chain
-		for (const FLyraSubmixEffectChainMap& SoftSubmixEffectChain : LyraAudioSettings->LDRAudioSubmixEffectChain)
+		AssetsToLoad.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+
+		if (AssetsToLoad.Num() > 0)
 		{
-			FLyraAudioSubmixEffectsChain NewEffectChain;
+			AudioAssetsLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetsToLoad), FStreamableDelegate::CreateUObject(this, &ThisClass::OnAudioAssetsLoaded));
+		}
+	}
 
-			if (UObject* SubmixObjPath = SoftSubmixEffectChain.Submix.LoadSynchronous())
-			{
-				if (USoundSubmix* Submix = Cast<USoundSubmix>(SubmixObjPath))
-				{
-					NewEffectChain.Submix = Submix;
-					TArray<USoundEffectSubmixPreset*> NewPresetChain;
+	// Register with the loading screen manager
+	if (ULoadingScreenManager* LoadingScreenManager = UGameInstance::GetSubsystem<ULoadingScreenManager>(GetWorld()->GetGameInstance()))
+	{
+		LoadingScreenManager->OnLoadingScreenVisibilityChangedDelegate().AddUObject(this, &ThisClass::OnLoadingScreenStatusChanged);
+	}
 
-					for (const TSoftObjectPtr<USoundEffectSubmixPreset>& SoftEffect : SoftSubmixEffectChain.SubmixEffectChain)
-					{
-						if (UObject* EffectObjPath = SoftEffect.LoadSynchronous())
-						{
-							if (USoundEffectSubmixPreset* SubmixPreset = Cast<USoundEffectSubmixPreset>(EffectObjPath))
-							{
-								NewPresetChain.Add(SubmixPreset);
-							}
-						}
-					}
+	// Nothing to wait on
+	if (!AudioAssetsLoadHandle.IsValid() && !bAudioAssetsLoaded)
+	{
+		OnAudioAssetsLoaded();
+	}
+}
 
-					NewEffectChain.SubmixEffectChain.Append(NewPresetChain);
-				}
-			}
+void ULyraAudioMixEffectsSubsystem::OnAudioAssetsLoaded()
+{
+	bAudioAssetsLoaded = true;
 
-			LDRSubmixEffectChain.Add(NewEffectChain);
-		}
+	if (const ULyraAudioSettings* LyraAudioSettings = GetDefault<ULyraAudioSettings>())
+	{
+		DefaultBaseMix = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBusMix>(LyraAudioSettings->DefaultControlBusMix, TEXT("Default Control Bus Mix"));
+		LoadingScreenMix = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBusMix>(LyraAudioSettings->LoadingScreenControlBusMix, TEXT("Loading Screen Control Bus Mix"));
+		UserMix = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBusMix>(LyraAudioSettings->UserSettingsControlBusMix, TEXT("User Control Bus Mix"));
+		OverallControlBus = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBus>(LyraAudioSettings->OverallVolumeControlBus, TEXT("Overall Control Bus"));
+		MusicControlBus = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBus>(LyraAudioSettings->MusicVolumeControlBus, TEXT("Music Control Bus"));
+		SoundFXControlBus = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBus>(LyraAudioSettings->SoundFXVolumeControlBus, TEXT("SoundFX Control Bus"));
+		DialogueControlBus = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBus>(LyraAudioSettings->DialogueVolumeControlBus, TEXT("Dialogue Control Bus"));
+		VoiceChatControlBus = LyraAudioMixEffects::ResolveLoadedAsset<USoundControlBus>(LyraAudioSettings->VoiceChatVolumeControlBus, TEXT("VoiceChat Control Bus"));
+
+		LyraAudioMixEffects::ResolveSubmixEffectChains(LyraAudioSettings->HDRAudioSubmixEffectChain, HDRSubmixEffectChain);
+		LyraAudioMixEffects::ResolveSubmixEffectChains(LyraAudioSettings->LDRAudioSubmixEffectChain, LDRSubmixEffectChain);
 	}
 
-	// Register with the loading screen manager
+	// Catch up on the loading screen state we couldn't act on without the mix
 	if (ULoadingScreenManager* LoadingScreenManager = UGameInstance::GetSubsystem<ULoadingScreenManager>(GetWorld()->GetGameInstance()))
 	{
-		LoadingScreenManager->OnLoadingScreenVisibilityChangedDelegate().AddUObject(this, &ThisClass::OnLoadingScreenStatusChanged);
 		ApplyOrRemoveLoadingScreenMix(LoadingScreenManager->GetLoadingScreenDisplayStatus());
 	}
+
+	if (bWorldBeganPlay)
+	{
+		ApplyUserMixAndEffectsChains();
+		SetMutedUntilMixesApplied(false);
+	}
 }
 
 void ULyraAudioMixEffectsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 {
-	if (const UWorld* World = InWorld.GetWorld())
+	bWorldBeganPlay = true;
+
+	if (bAudioAssetsLoaded)
+	{
+		ApplyUserMixAndEffectsChains();
+	}
+	else
+	{
+		// Until the user's volume mix can be applied, keep the world quiet rather than playing at full volume
+		SetMutedUntilMixesApplied(true);
+	}
+}
+
+void ULyraAudioMixEffectsSubsystem::ApplyUserMixAndEffectsChains()
+{
+	if (const UWorld* World = GetWorld())
 	{
 		// Activate the default base mix
 		if (DefaultBaseMix)
@@ -260,6 +235,29 @@ void ULyraAudioMixEffectsSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	}
 }
 
+void ULyraAudioMixEffectsSubsystem::SetMutedUntilMixesApplied(bool bMuted)
+{
+	if (bMutedUntilMixesApplied == bMuted)
+	{
+		return;
+	}
+
+	if (FAudioDeviceHandle AudioDevice = GetWorld()->GetAudioDevice())
+	{
+		if (bMuted)
+		{
+			VolumeBeforeMute = AudioDevice->GetTransientPrimaryVolume();
+			AudioDevice->SetTransientPrimaryVolume(0.0f);
+		}
+		else
+		{
+			AudioDevice->SetTransientPrimaryVolume(VolumeBeforeMute);
+		}
+
+		bMutedUntilMixesApplied = bMuted;
+	}
+}
+
 void ULyraAudioMixEffectsSubsystem::ApplyDynamicRangeEffectsChains(bool bHDRAudio)
 {
 	TArray<FLyraAudioSubmixEffectsChain> AudioSubmixEffectsChainToApply;
@@ -7,6 +7,7 @@
 #include "LyraAudioMixEffectsSubsystem.generated.h"
 
 class FSubsystemCollectionBase;
+struct FStreamableHandle;
 class UObject;
 class USoundControlBus;
 class USoundControlBusMix;
@@ -48,7 +49,7 @@ public:
 
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
 
-	/** Called once all UWorldSubsystems have been initialized */
+	/** Called once all UWorldSubsystems have been initialized; requests the audio settings assets as one async batch */
 	virtual void PostInitialize() override;
 
 	/** Called when world is ready to start gameplay before the game mode transitions to the correct state and call BeginPlay on all actors */
@@ -58,6 +59,15 @@ public:
 	void ApplyDynamicRangeEffectsChains(bool bHDRAudio);
 	
 protected:
+	/** Called when the batched audio assets finish loading, applies anything that was waiting on them */
+	void OnAudioAssetsLoaded();
+
+	/** Activates the default and user mixes and the dynamic range effect chains for the world */
+	void ApplyUserMixAndEffectsChains();
+
+	/** Holds the world at zero volume while play has begun but the user's volume mix can't be applied yet */
+	void SetMutedUntilMixesApplied(bool bMuted);
+
 	void OnLoadingScreenStatusChanged(bool bShowingLoadingScreen);
 	void ApplyOrRemoveLoadingScreenMix(bool bWantsLoadingScreenMix);
 	
@@ -104,5 +114,14 @@ protected:
 	UPROPERTY(Transient)
 	TArray<FLyraAudioSubmixEffectsChain> LDRSubmixEffectChain;
 
+	// Handle for the batched async load of all the assets referenced by the Lyra Audio Settings
+	TSharedPtr<FStreamableHandle> AudioAssetsLoadHandle;
+
+	// Primary volume to restore once the mixes have been applied
+	float VolumeBeforeMute = 1.0f;
+
 	bool bAppliedLoadingScreenMix = false;
+	bool bAudioAssetsLoaded = false;
+	bool bWorldBeganPlay = false;
+	bool bMutedUntilMixesApplied = false;
 };
@@ -201,9 +201,49 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 	FCollisionShape SphereShape = FCollisionShape::MakeSphere(0.f);
 	UWorld* World = GetWorld();
 
+	const bool bUseAsyncFeelers = bAsyncPredictiveFeelers && !bSingleRayOnly;
+	if (!bUseAsyncFeelers)
+	{
+		ResetAsyncFeelerTraces();
+	}
+
 	for (int32 RayIdx = 0; RayIdx < NumRaysToShoot; ++RayIdx)
 	{
 		FLyraPenetrationAvoidanceFeeler& Feeler = PenetrationAvoidanceFeelers[RayIdx];
+
+		// The main ray is always traced synchronously, only the predictive feelers can use last frame's async results
+		const bool bAsyncFeeler = bUseAsyncFeelers && (RayIdx > 0);
+		if (bAsyncFeeler && Feeler.AsyncTraceHandle.IsValid())
+		{
+			FTraceDatum TraceDatum;
+			if (World->QueryTraceData(Feeler.AsyncTraceHandle, TraceDatum))
+			{
+				const FHitResult* Hit = FHitResult::GetFirstBlockingHit(TraceDatum.OutHits);
+				if (Hit && Hit->GetActor() && ShouldCameraPenetrationHitBlock(ViewTarget, *Hit, SphereParams))
+				{
+					// The sweep was issued from last frame's safe location, so express the block as a fraction of that ray
+					const float NewBlockPct = ((Hit->Location - TraceDatum.Start).Size() - CollisionPushOutDistance) / (TraceDatum.End - TraceDatum.Start).Size();
+					DistBlockedPctThisFrame = FMath::Min(NewBlockPct, DistBlockedPctThisFrame);
+
+					// This feeler got a hit, so do another trace next frame
+					Feeler.FramesUntilNextTrace = 0;
+				}
+
+				SoftBlockedPct = DistBlockedPctThisFrame;
+
+#if ENABLE_DRAW_DEBUG
+				if (World->TimeSince(LastDrawDebugTime) < 1.f)
+				{
+					DrawDebugSphere(World, TraceDatum.Start, Feeler.Extent, 8, FColor::Orange);
+					DrawDebugSphere(World, Hit ? Hit->Location : TraceDatum.End, Feeler.Extent, 8, FColor::Orange);
+					DrawDebugLine(World, TraceDatum.Start, Hit ? Hit->Location : TraceDatum.End, FColor::Orange);
+				}
+#endif // ENABLE_DRAW_DEBUG
+			}
+
+			Feeler.AsyncTraceHandle = FTraceHandle();
+		}
+
 		if (Feeler.FramesUntilNextTrace <= 0)
 		{
 			// calc ray target
@@ -219,6 +259,15 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 			SphereShape.Sphere.Radius = Feeler.Extent;
 			ECollisionChannel TraceChannel = ECC_Camera;		//(Feeler.PawnWeight > 0.f) ? ECC_Pawn : ECC_Camera;
 
+			Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
+
+			if (bAsyncFeeler)
+			{
+				// Results are picked up next frame
+				Feeler.AsyncTraceHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, SafeLoc, RayTarget, FQuat::Identity, TraceChannel, SphereShape, SphereParams);
+				continue;
+			}
+
 			// do multi-line check to make sure the hits we throw out aren't
 			// masking real hits behind (these are important rays).
 
@@ -234,59 +283,20 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 			}
 #endif // ENABLE_DRAW_DEBUG
 
-			Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
-
 			const AActor* HitActor = Hit.GetActor();
 
-			if (bHit && HitActor)
+			if (bHit && HitActor && ShouldCameraPenetrationHitBlock(ViewTarget, Hit, SphereParams))
 			{
-				bool bIgnoreHit = false;
-
-				if (HitActor->ActorHasTag(LyraCameraMode_ThirdPerson_Statics::NAME_IgnoreCameraCollision))
-				{
-					bIgnoreHit = true;
-					SphereParams.AddIgnoredActor(HitActor);
-				}
+				float const Weight = Cast<APawn>(Hit.GetActor()) ? Feeler.PawnWeight : Feeler.WorldWeight;
+				float NewBlockPct = Hit.Time;
+				NewBlockPct += (1.f - NewBlockPct) * (1.f - Weight);
 
-				// Ignore CameraBlockingVolume hits that occur in front of the ViewTarget.
-				if (!bIgnoreHit && HitActor->IsA<ACameraBlockingVolume>())
-				{
-					const FVector ViewTargetForwardXY = ViewTarget.GetActorForwardVector().GetSafeNormal2D();
-					const FVector ViewTargetLocation = ViewTarget.GetActorLocation();
-					const FVector HitOffset = Hit.Location - ViewTargetLocation;
-					const FVector HitDirectionXY = HitOffset.GetSafeNormal2D();
-					const float DotHitDirection = FVector::DotProduct(ViewTargetForwardXY, HitDirectionXY);
-					if (DotHitDirection > 0.0f)
-					{
-						bIgnoreHit = true;
-						// Ignore this CameraBlockingVolume on the remaining sweeps.
-						SphereParams.AddIgnoredActor(HitActor);
-					}
-					else
-					{
-#if ENABLE_DRAW_DEBUG
-						DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
-#endif
-					}
-				}
-				
-				if (!bIgnoreHit)
-				{
-					float const Weight = Cast<APawn>(Hit.GetActor()) ? Feeler.PawnWeight : Feeler.WorldWeight;
-					float NewBlockPct = Hit.Time;
-					NewBlockPct += (1.f - NewBlockPct) * (1.f - Weight);
+				// Recompute blocked pct taking into account pushout distance.
+				NewBlockPct = ((Hit.Location - SafeLoc).Size() - CollisionPushOutDistance) / (RayTarget - SafeLoc).Size();
+				DistBlockedPctThisFrame = FMath::Min(NewBlockPct, DistBlockedPctThisFrame);
 
-					// Recompute blocked pct taking into account pushout distance.
-					NewBlockPct = ((Hit.Location - SafeLoc).Size() - CollisionPushOutDistance) / (RayTarget - SafeLoc).Size();
-					DistBlockedPctThisFrame = FMath::Min(NewBlockPct, DistBlockedPctThisFrame);
-
-					// This feeler got a hit, so do another trace next frame
-					Feeler.FramesUntilNextTrace = 0;
-
-#if ENABLE_DRAW_DEBUG
-					DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
-#endif
-				}
+				// This feeler got a hit, so do another trace next frame
+				Feeler.FramesUntilNextTrace = 0;
 			}
 
 			if (RayIdx == 0)
@@ -349,6 +359,48 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 	}
 }
 
+bool ULyraCameraMode_ThirdPerson::ShouldCameraPenetrationHitBlock(AActor const& ViewTarget, const FHitResult& Hit, FCollisionQueryParams& InOutParams)
+{
+	const AActor* HitActor = Hit.GetActor();
+	check(HitActor);
+
+	if (HitActor->ActorHasTag(LyraCameraMode_ThirdPerson_Statics::NAME_IgnoreCameraCollision))
+	{
+		InOutParams.AddIgnoredActor(HitActor);
+		return false;
+	}
+
+	// Ignore CameraBlockingVolume hits that occur in front of the ViewTarget.
+	if (HitActor->IsA<ACameraBlockingVolume>())
+	{
+		const FVector ViewTargetForwardXY = ViewTarget.GetActorForwardVector().GetSafeNormal2D();
+		const FVector ViewTargetLocation = ViewTarget.GetActorLocation();
+		const FVector HitOffset = Hit.Location - ViewTargetLocation;
+		const FVector HitDirectionXY = HitOffset.GetSafeNormal2D();
+		const float DotHitDirection = FVector::DotProduct(ViewTargetForwardXY, HitDirectionXY);
+		if (DotHitDirection > 0.0f)
+		{
+			// Ignore this CameraBlockingVolume on the remaining sweeps.
+			InOutParams.AddIgnoredActor(HitActor);
+			return false;
+		}
+	}
+
+#if ENABLE_DRAW_DEBUG
+	DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
+#endif
+
+	return true;
+}
+
+void ULyraCameraMode_ThirdPerson::ResetAsyncFeelerTraces()
+{
+	for (FLyraPenetrationAvoidanceFeeler& Feeler : PenetrationAvoidanceFeelers)
+	{
+		Feeler.AsyncTraceHandle = FTraceHandle();
+	}
+}
+
 void ULyraCameraMode_ThirdPerson::SetTargetCrouchOffset(FVector NewTargetOffset)
 {
 	CrouchOffsetBlendPct = 0.0f;
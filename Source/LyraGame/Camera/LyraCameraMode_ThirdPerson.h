@@ -32,6 +32,12 @@ protected:
 	void UpdatePreventPenetration(float DeltaTime);
 	void PreventCameraPenetration(class AActor const& ViewTarget, FVector const& SafeLoc, FVector& CameraLoc, float const& DeltaTime, float& DistBlockedPct, bool bSingleRayOnly);
 
+	// Returns true if the hit should block the camera, otherwise adds the hit actor to the ignore list if it should be skipped from now on
+	bool ShouldCameraPenetrationHitBlock(AActor const& ViewTarget, const FHitResult& Hit, FCollisionQueryParams& InOutParams);
+
+	// Drops any pending async feeler sweeps
+	void ResetAsyncFeelerTraces();
+
 	virtual void DrawDebug(UCanvas* Canvas) const override;
 
 protected:
@@ -74,6 +80,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Collision")
 	bool bDoPredictiveAvoidance = true;
 
+	/**
+	 * If true, the predictive feelers (index 1+) are swept asynchronously and their results consumed the following frame.
+	 * The main feeler always stays synchronous; the one frame of latency is hidden by PenetrationBlendInTime smoothing.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Collision", meta=(EditCondition="bDoPredictiveAvoidance"))
+	bool bAsyncPredictiveFeelers = false;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision")
 	float CollisionPushOutDistance = 2.f;
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "WorldCollision.h"
 
 #include "LyraPenetrationAvoidanceFeeler.generated.h"
 
@@ -38,6 +39,9 @@ struct FLyraPenetrationAvoidanceFeeler
 	UPROPERTY(transient)
 	int32 FramesUntilNextTrace;
 
+	/** pending async sweep issued last frame (only used with async predictive feelers) */
+	FTraceHandle AsyncTraceHandle;
+
 
 	FLyraPenetrationAvoidanceFeeler()
 		: AdjustmentRot(ForceInit)
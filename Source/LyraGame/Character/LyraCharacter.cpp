@@ -8,12 +8,15 @@
 #include "Character/LyraPawnExtensionComponent.h" // Lyra Pawn의 확장 기능을 위한 컴포넌트 선언부. 어빌리티 시스템 초기화, 입력 바인딩, 컨트롤러/플레이어 상태 변화 처리 등 확장 기능을 담당합니다.
 #include "Components/CapsuleComponent.h"  
 #include "Components/SkeletalMeshComponent.h" // 본 기반 애니메이션, 메시 렌더링, 충돌 등 캐릭터의 외형을 담당합니다.
+#include "Engine/NetSerialization.h"
 #include "LyraCharacterMovementComponent.h"
 #include "LyraGameplayTags.h"
 #include "LyraLogChannels.h"
 #include "Net/UnrealNetwork.h"
 #include "Player/LyraPlayerController.h"
 #include "Player/LyraPlayerState.h"
+#include "Serialization/BitWriter.h"
+#include "System/LyraReplicationGraphSettings.h"
 #include "System/LyraSignificanceManager.h"
 #include "TimerManager.h"
 
@@ -28,6 +31,196 @@ class UInputComponent;
 static FName NAME_LyraCharacterCollisionProfile_Capsule(TEXT("LyraPawnCapsule"));
 static FName NAME_LyraCharacterCollisionProfile_Mesh(TEXT("LyraPawnMesh"));
 
+// FastShared 이동 양자화 프로필 및 대역폭 통계
+namespace LyraSharedMovement
+{
+	// 프로필 인덱스는 2비트로 전송
+	static constexpr int32 MaxProfiles = 4;
+
+	static int32 EnableStats = 0;
+	static FAutoConsoleVariableRef CVarEnableStats(TEXT("Lyra.Net.SharedMovementStats"), EnableStats, TEXT("If non-zero, FastShared movement updates record their size per quantization profile. See Lyra.Net.SharedMovementReport."), ECVF_Default);
+
+	struct FProfileStats
+	{
+		int64 NumUpdates = 0;
+		int64 TotalBits = 0;
+		int64 TotalFullPrecisionBits = 0;
+	};
+	static FProfileStats ProfileStats[MaxProfiles];
+
+	static const FLyraSharedMovementQuantizationProfile& GetProfile(uint8 ProfileIndex)
+	{
+		// 프로필이 설정되지 않은 경우 기본(최고 정밀도) 프로필 사용
+		static const FLyraSharedMovementQuantizationProfile DefaultProfile;
+
+		const TArray<FLyraSharedMovementQuantizationProfile>& Profiles = GetDefault<ULyraReplicationGraphSettings>()->SharedMovementQuantizationProfiles;
+		const int32 NumProfiles = FMath::Min(Profiles.Num(), MaxProfiles);
+		return (NumProfiles > 0) ? Profiles[FMath::Min<int32>(ProfileIndex, NumProfiles - 1)] : DefaultProfile;
+	}
+
+	// 엔진의 FRepMovement 양자화와 같은 비트 수 사용
+	static bool SerializeQuantizedVector(FArchive& Ar, FVector& Vector, EVectorQuantization QuantizationLevel)
+	{
+		switch (QuantizationLevel)
+		{
+		case EVectorQuantization::RoundTwoDecimals:
+			return SerializePackedVector<100, 30>(Vector, Ar);
+		case EVectorQuantization::RoundOneDecimal:
+			return SerializePackedVector<10, 27>(Vector, Ar);
+		default:
+			return SerializePackedVector<1, 24>(Vector, Ar);
+		}
+	}
+
+	static FVector QuantizeVector(const FVector& Vector, EVectorQuantization QuantizationLevel)
+	{
+		const double Scale = (QuantizationLevel == EVectorQuantization::RoundTwoDecimals) ? 100.0 : ((QuantizationLevel == EVectorQuantization::RoundOneDecimal) ? 10.0 : 1.0);
+		return FVector(FMath::RoundToDouble(Vector.X * Scale) / Scale, FMath::RoundToDouble(Vector.Y * Scale) / Scale, FMath::RoundToDouble(Vector.Z * Scale) / Scale);
+	}
+
+	static FRotator QuantizeRotator(const FRotator& Rotator, ERotatorQuantization QuantizationLevel)
+	{
+		if (QuantizationLevel == ERotatorQuantization::ByteComponents)
+		{
+			return FRotator(
+				FRotator::DecompressAxisFromByte(FRotator::CompressAxisToByte(Rotator.Pitch)),
+				FRotator::DecompressAxisFromByte(FRotator::CompressAxisToByte(Rotator.Yaw)),
+				FRotator::DecompressAxisFromByte(FRotator::CompressAxisToByte(Rotator.Roll)));
+		}
+
+		return FRotator(
+			FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotator.Pitch)),
+			FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotator.Yaw)),
+			FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Rotator.Roll)));
+	}
+
+	// 뷰어 위치와, 그 뷰어가 조종하거나 보고 있는 액터 (해당 폰은 이 뷰어에게 FastShared 업데이트를 받지 않음)
+	struct FViewerLocation
+	{
+		FVector Location;
+		const AActor* Pawn = nullptr;
+		const AActor* ViewTarget = nullptr;
+	};
+
+	// 한 프레임 동안 모든 폰이 공유하는 뷰어 위치 캐시
+	struct FViewerLocationCache
+	{
+		TWeakObjectPtr<const UWorld> World;
+		uint64 Frame = 0;
+		TArray<FViewerLocation> Locations;
+	};
+	static FViewerLocationCache ViewerLocationCache;
+
+	static const TArray<FViewerLocation>& GetViewerLocations(const UWorld* World)
+	{
+		if ((ViewerLocationCache.Frame != GFrameCounter) || (ViewerLocationCache.World.Get() != World))
+		{
+			ViewerLocationCache.World = World;
+			ViewerLocationCache.Frame = GFrameCounter;
+			ViewerLocationCache.Locations.Reset();
+
+			for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+			{
+				if (const APlayerController* PC = It->Get())
+				{
+					FVector ViewLocation;
+					FRotator ViewRotation;
+					PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+					ViewerLocationCache.Locations.Add({ ViewLocation, PC->GetPawn(), PC->GetViewTarget() });
+				}
+			}
+		}
+
+		return ViewerLocationCache.Locations;
+	}
+
+	// 이동 모드, 점프, 앉기, 타임스탬프 (프로필과 무관하게 동일하게 직렬화)
+	static void SerializeSharedFields(FArchive& Ar, FSharedRepMovement& SharedMovement)
+	{
+		Ar << SharedMovement.RepMovementMode;
+		Ar << SharedMovement.bProxyIsJumpForceApplied;
+		Ar << SharedMovement.bIsCrouched;
+
+		// 타임스탬프가 0이 아니면 직렬화
+		uint8 bHasTimeStamp = (SharedMovement.RepTimeStamp != 0.f);
+		Ar.SerializeBits(&bHasTimeStamp, 1);
+		if (bHasTimeStamp)
+		{
+			Ar << SharedMovement.RepTimeStamp;
+		}
+		else
+		{
+			SharedMovement.RepTimeStamp = 0.f;
+		}
+	}
+
+	// 프로필 적용 후 전송 비트 수와 기존 전체 정밀도 FRepMovement 경로의 비트 수 기록
+	static void RecordUpdateStats(const FSharedRepMovement& SharedMovement)
+	{
+		bool bSuccess = true;
+		FSharedRepMovement Copy = SharedMovement;
+
+		FBitWriter ProfileWriter(0, true);
+		Copy.NetSerialize(ProfileWriter, nullptr, bSuccess);
+
+		FBitWriter FullPrecisionWriter(0, true);
+		FRepMovement FullPrecisionMovement = SharedMovement.RepMovement;
+		FullPrecisionMovement.LocationQuantizationLevel = EVectorQuantization::RoundTwoDecimals;
+		FullPrecisionMovement.VelocityQuantizationLevel = EVectorQuantization::RoundWholeNumber;
+		FullPrecisionMovement.RotationQuantizationLevel = ERotatorQuantization::ByteComponents;
+		FullPrecisionMovement.NetSerialize(FullPrecisionWriter, nullptr, bSuccess);
+		SerializeSharedFields(FullPrecisionWriter, Copy);
+
+		FProfileStats& Stats = ProfileStats[FMath::Min<int32>(SharedMovement.QuantizationProfileIndex, MaxProfiles - 1)];
+		Stats.NumUpdates++;
+		Stats.TotalBits += ProfileWriter.GetNumBits();
+		Stats.TotalFullPrecisionBits += FullPrecisionWriter.GetNumBits();
+	}
+
+	static void HandleReportCommand(const TArray<FString>& Args)
+	{
+		if ((Args.Num() > 0) && (Args[0] == TEXT("reset")))
+		{
+			for (FProfileStats& Stats : ProfileStats)
+			{
+				Stats = FProfileStats();
+			}
+			UE_LOG(LogConsoleResponse, Display, TEXT("FastShared movement stats reset."));
+			return;
+		}
+
+		if (EnableStats == 0)
+		{
+			UE_LOG(LogConsoleResponse, Display, TEXT("Lyra.Net.SharedMovementStats is disabled, enable it to collect FastShared movement stats."));
+		}
+
+		int64 TotalBits = 0;
+		int64 TotalFullPrecisionBits = 0;
+		for (int32 ProfileIndex = 0; ProfileIndex < MaxProfiles; ++ProfileIndex)
+		{
+			const FProfileStats& Stats = ProfileStats[ProfileIndex];
+			if (Stats.NumUpdates > 0)
+			{
+				UE_LOG(LogConsoleResponse, Display, TEXT("Profile %d: %lld updates, %.1f bits/update (full precision %.1f bits/update)"),
+					ProfileIndex, Stats.NumUpdates, double(Stats.TotalBits) / Stats.NumUpdates, double(Stats.TotalFullPrecisionBits) / Stats.NumUpdates);
+			}
+			TotalBits += Stats.TotalBits;
+			TotalFullPrecisionBits += Stats.TotalFullPrecisionBits;
+		}
+
+		if (TotalFullPrecisionBits > 0)
+		{
+			UE_LOG(LogConsoleResponse, Display, TEXT("Total: %lld bits sent, %lld bits at full precision (%.1f%% saved)"),
+				TotalBits, TotalFullPrecisionBits, 100.0 * (1.0 - double(TotalBits) / TotalFullPrecisionBits));
+		}
+	}
+
+	static FAutoConsoleCommand SharedMovementReportCommand(
+		TEXT("Lyra.Net.SharedMovementReport"),
+		TEXT("Prints bits per FastShared movement update for each quantization profile compared to full precision. Pass 'reset' to clear the stats."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleReportCommand));
+}
+
 // Lyra 캐릭터 생성자
 ALyraCharacter::ALyraCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer.SetDefaultSubobjectClass<ULyraCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
@@ -583,12 +776,21 @@ bool ALyraCharacter::UpdateSharedReplication()
 		FSharedRepMovement SharedMovement;
 		if (SharedMovement.FillForCharacter(this))
 		{
+			// 가장 가까운 뷰어 거리에 맞는 정밀도로 양자화 (공유 직렬화라 모든 연결이 같은 번치를 받음)
+			SharedMovement.QuantizationProfileIndex = SelectSharedMovementQuantizationProfile();
+			SharedMovement.ApplyQuantizationProfile();
+
 			// 데이터가 변경된 경우에만 FastSharedReplication 호출
 			if (!SharedMovement.Equals(LastSharedReplication, this))
 			{
 				LastSharedReplication = SharedMovement;
 				ReplicatedMovementMode = SharedMovement.RepMovementMode;
 
+				if (LyraSharedMovement::EnableStats != 0)
+				{
+					LyraSharedMovement::RecordUpdateStats(SharedMovement);
+				}
+
 				FastSharedReplication(SharedMovement);
 			}
 			return true;
@@ -599,6 +801,41 @@ bool ALyraCharacter::UpdateSharedReplication()
 	return false;
 }
 
+// 가장 가까운 뷰어까지의 거리로 FastShared 이동 양자화 프로필 선택
+uint8 ALyraCharacter::SelectSharedMovementQuantizationProfile() const
+{
+	const TArray<FLyraSharedMovementQuantizationProfile>& Profiles = GetDefault<ULyraReplicationGraphSettings>()->SharedMovementQuantizationProfiles;
+	const int32 NumProfiles = FMath::Min(Profiles.Num(), LyraSharedMovement::MaxProfiles);
+	if (NumProfiles <= 1)
+	{
+		return 0;
+	}
+
+	const FVector PawnLocation = GetActorLocation();
+	double ClosestDistanceSq = TNumericLimits<double>::Max();
+	for (const LyraSharedMovement::FViewerLocation& Viewer : LyraSharedMovement::GetViewerLocations(GetWorld()))
+	{
+		// 자신을 조종하거나 보고 있는 뷰어는 제외 (항상 거리 0이라 모든 플레이어 폰이 프로필 0에 고정됨)
+		if ((Viewer.Pawn == this) || (Viewer.ViewTarget == this))
+		{
+			continue;
+		}
+
+		ClosestDistanceSq = FMath::Min(ClosestDistanceSq, FVector::DistSquared(PawnLocation, Viewer.Location));
+	}
+
+	// 마지막 프로필은 나머지 모든 거리를 담당
+	for (int32 ProfileIndex = 0; ProfileIndex < NumProfiles - 1; ++ProfileIndex)
+	{
+		if (ClosestDistanceSq <= FMath::Square(Profiles[ProfileIndex].MaxViewerDistance))
+		{
+			return (uint8)ProfileIndex;
+		}
+	}
+
+	return (uint8)(NumProfiles - 1);
+}
+
 // FastSharedReplication 구현 (클라이언트 동기화)
 void ALyraCharacter::FastSharedReplication_Implementation(const FSharedRepMovement& SharedRepMovement)
 {
@@ -623,8 +860,18 @@ void ALyraCharacter::FastSharedReplication_Implementation(const FSharedRepMoveme
 
 		// 위치, 회전, 속도 등
 		FRepMovement& MutableRepMovement = GetReplicatedMovement_Mutable();
+		const FVector PreviousLocation = MutableRepMovement.Location;
 		MutableRepMovement = SharedRepMovement.RepMovement;
 
+		// 속도를 전송하지 않는 원거리 프로필은 이전 수신 위치와의 차이로 속도 추정
+		const double ReceiveTime = GetWorld()->GetTimeSeconds();
+		if (!SharedRepMovement.HasReplicatedVelocity())
+		{
+			const double DeltaTime = ReceiveTime - LastSharedReplicationReceiveTime;
+			MutableRepMovement.LinearVelocity = ((DeltaTime > UE_KINDA_SMALL_NUMBER) && (DeltaTime < 1.0)) ? (MutableRepMovement.Location - PreviousLocation) / DeltaTime : FVector::ZeroVector;
+		}
+		LastSharedReplicationReceiveTime = ReceiveTime;
+
 		// LastRepMovement도 갱신
 		OnRep_ReplicatedMovement();
 
@@ -708,29 +955,74 @@ bool FSharedRepMovement::Equals(const FSharedRepMovement& Other, ACharacter* Cha
 		return false;
 	}
 
+	if (QuantizationProfileIndex != Other.QuantizationProfileIndex)
+	{
+		return false;
+	}
+
 	return true;
 }
 
+// 선택된 양자화 프로필 정밀도로 값 반올림
+void FSharedRepMovement::ApplyQuantizationProfile()
+{
+	const FLyraSharedMovementQuantizationProfile& Profile = LyraSharedMovement::GetProfile(QuantizationProfileIndex);
+
+	RepMovement.LocationQuantizationLevel = Profile.LocationQuantization;
+	RepMovement.RotationQuantizationLevel = Profile.RotationQuantization;
+	RepMovement.VelocityQuantizationLevel = Profile.VelocityQuantization;
+
+	RepMovement.Location = LyraSharedMovement::QuantizeVector(RepMovement.Location, Profile.LocationQuantization);
+	RepMovement.Rotation = LyraSharedMovement::QuantizeRotator(RepMovement.Rotation, Profile.RotationQuantization);
+	RepMovement.LinearVelocity = Profile.bReplicateVelocity ? LyraSharedMovement::QuantizeVector(RepMovement.LinearVelocity, Profile.VelocityQuantization) : FVector::ZeroVector;
+}
+
+// 선택된 프로필이 속도를 전송하는지 여부
+bool FSharedRepMovement::HasReplicatedVelocity() const
+{
+	return LyraSharedMovement::GetProfile(QuantizationProfileIndex).bReplicateVelocity;
+}
+
 // FSharedRepMovement 네트워크 직렬화
 bool FSharedRepMovement::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
 	bOutSuccess = true;
-	RepMovement.NetSerialize(Ar, Map, bOutSuccess);
-	Ar << RepMovementMode;
-	Ar << bProxyIsJumpForceApplied;
-	Ar << bIsCrouched;
 
-	// 타임스탬프가 0이 아니면 직렬화
-	uint8 bHasTimeStamp = (RepTimeStamp != 0.f);
-	Ar.SerializeBits(&bHasTimeStamp, 1);
-	if (bHasTimeStamp)
+	// 양자화 프로필 인덱스 (수신 측도 같은 설정의 프로필로 역직렬화)
+	uint32 ProfileIndex = QuantizationProfileIndex;
+	Ar.SerializeInt(ProfileIndex, LyraSharedMovement::MaxProfiles);
+	QuantizationProfileIndex = (uint8)ProfileIndex;
+
+	const FLyraSharedMovementQuantizationProfile& Profile = LyraSharedMovement::GetProfile(QuantizationProfileIndex);
+	if (Ar.IsLoading())
+	{
+		RepMovement.LocationQuantizationLevel = Profile.LocationQuantization;
+		RepMovement.RotationQuantizationLevel = Profile.RotationQuantization;
+		RepMovement.VelocityQuantizationLevel = Profile.VelocityQuantization;
+	}
+
+	bOutSuccess &= LyraSharedMovement::SerializeQuantizedVector(Ar, RepMovement.Location, Profile.LocationQuantization);
+
+	if (Profile.RotationQuantization == ERotatorQuantization::ByteComponents)
 	{
-		Ar << RepTimeStamp;
+		RepMovement.Rotation.SerializeCompressed(Ar);
 	}
 	else
 	{
-		RepTimeStamp = 0.f;
+		RepMovement.Rotation.SerializeCompressedShort(Ar);
+	}
+
+	// 원거리 프로필은 속도 생략
+	if (Profile.bReplicateVelocity)
+	{
+		bOutSuccess &= LyraSharedMovement::SerializeQuantizedVector(Ar, RepMovement.LinearVelocity, Profile.VelocityQuantization);
 	}
+	else if (Ar.IsLoading())
+	{
+		RepMovement.LinearVelocity = FVector::ZeroVector;
+	}
+
+	LyraSharedMovement::SerializeSharedFields(Ar, *this);
 
 	return true;
 }
\ No newline at end of file
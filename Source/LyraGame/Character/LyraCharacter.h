@@ -62,6 +62,9 @@ struct FSharedRepMovement
     bool Equals(const FSharedRepMovement& Other, ACharacter* Character) const; // 비교
     bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess); // 네트워크 직렬화
 
+    void ApplyQuantizationProfile(); // 선택된 양자화 프로필 정밀도로 값 반올림 (Equals 비교가 실제 전송 값 기준이 되도록)
+    bool HasReplicatedVelocity() const; // 선택된 프로필이 속도를 전송하는지 여부
+
     UPROPERTY(Transient)
     FRepMovement RepMovement;    // 기본 이동 정보
 
@@ -76,6 +79,9 @@ struct FSharedRepMovement
 
     UPROPERTY(Transient)
     bool bIsCrouched = false;   // 앉기 상태 여부
+
+    UPROPERTY(Transient)
+    uint8 QuantizationProfileIndex = 0; // 양자화 프로필 인덱스 (ULyraReplicationGraphSettings::SharedMovementQuantizationProfiles, 2비트로 전송)
 };
 
 // 네트워크 직렬화 지원을 위한 Traits
@@ -155,6 +161,11 @@ public:
     FSharedRepMovement LastSharedReplication; // 마지막으로 전송한 이동 정보
     virtual bool UpdateSharedReplication();
 
+    // 가장 가까운 뷰어까지의 거리로 FastShared 이동 양자화 프로필 선택
+    uint8 SelectSharedMovementQuantizationProfile() const;
+
+    double LastSharedReplicationReceiveTime = 0.0; // 마지막 FastShared 수신 시각 (속도 미전송 시 위치 차이로 속도 추정)
+
 protected:
     // --- 어빌리티 시스템 초기화/해제 ---
     virtual void OnAbilitySystemInitialized();
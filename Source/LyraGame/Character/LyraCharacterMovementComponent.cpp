@@ -16,6 +16,18 @@ namespace LyraCharacter
 {
 	static float GroundTraceDistance = 100000.0f;
 	FAutoConsoleVariableRef CVar_GroundTraceDistance(TEXT("LyraCharacter.GroundTraceDistance"), GroundTraceDistance, TEXT("Distance to trace down when generating ground information."), ECVF_Cheat);
+
+	static float MinGroundTraceDistance = 500.0f;
+	FAutoConsoleVariableRef CVar_MinGroundTraceDistance(TEXT("LyraCharacter.MinGroundTraceDistance"), MinGroundTraceDistance, TEXT("Shortest distance to trace down when airborne, the trace is extended by the fall speed up to GroundTraceDistance."), ECVF_Cheat);
+
+	static float GroundTraceLookAheadTime = 1.0f;
+	FAutoConsoleVariableRef CVar_GroundTraceLookAheadTime(TEXT("LyraCharacter.GroundTraceLookAheadTime"), GroundTraceLookAheadTime, TEXT("Seconds of downward velocity added to the ground trace length when falling."), ECVF_Cheat);
+
+	static bool bAsyncGroundTrace = true;
+	FAutoConsoleVariableRef CVar_AsyncGroundTrace(TEXT("LyraCharacter.AsyncGroundTrace"), bAsyncGroundTrace, TEXT("If true, airborne ground traces are done asynchronously and their result is used the next frame."), ECVF_Default);
+
+	static float NonLocalGroundTraceInterval = 0.1f;
+	FAutoConsoleVariableRef CVar_NonLocalGroundTraceInterval(TEXT("LyraCharacter.NonLocalGroundTraceInterval"), NonLocalGroundTraceInterval, TEXT("Seconds between ground traces for characters that are not locally controlled."), ECVF_Default);
 };
 
 
@@ -49,6 +61,62 @@ bool ULyraCharacterMovementComponent::CanAttemptJump() const
 void ULyraCharacterMovementComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
+
+	GroundTraceDelegate.BindUObject(this, &ThisClass::HandleGroundTraceCompleted);
+}
+
+float ULyraCharacterMovementComponent::GetGroundTraceLength() const
+{
+	const float FallSpeed = FMath::Max(-Velocity.Z, 0.0f);
+	const float MaxTraceDistance = FMath::Max(LyraCharacter::GroundTraceDistance, LyraCharacter::MinGroundTraceDistance);
+	return FMath::Clamp(LyraCharacter::MinGroundTraceDistance + (FallSpeed * LyraCharacter::GroundTraceLookAheadTime), LyraCharacter::MinGroundTraceDistance, MaxTraceDistance);
+}
+
+void ULyraCharacterMovementComponent::StartGroundTrace(float TraceLength, bool bAsync)
+{
+	const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
+	check(CapsuleComp);
+
+	const float CapsuleHalfHeight = CapsuleComp->GetUnscaledCapsuleHalfHeight();
+	const ECollisionChannel CollisionChannel = (UpdatedComponent ? UpdatedComponent->GetCollisionObjectType() : ECC_Pawn);
+	const FVector TraceStart(GetActorLocation());
+	const FVector TraceEnd(TraceStart.X, TraceStart.Y, (TraceStart.Z - TraceLength - CapsuleHalfHeight));
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(LyraCharacterMovementComponent_GetGroundInfo), false, CharacterOwner);
+	FCollisionResponseParams ResponseParam;
+	InitCollisionParams(QueryParams, ResponseParam);
+
+	if (bAsync)
+	{
+		PendingGroundTraceHandle = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam, &GroundTraceDelegate);
+	}
+	else
+	{
+		FHitResult HitResult;
+		GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
+
+		PendingGroundTraceHandle = FTraceHandle();
+		LastGroundTraceHit = HitResult;
+		LastGroundTraceStart = TraceStart;
+		bHasGroundTraceResult = true;
+	}
+}
+
+void ULyraCharacterMovementComponent::HandleGroundTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	// Ignore traces that were abandoned because we landed in the meantime
+	if (!(TraceHandle == PendingGroundTraceHandle))
+	{
+		return;
+	}
+
+	PendingGroundTraceHandle = FTraceHandle();
+	LastGroundTraceHit = (TraceDatum.OutHits.Num() > 0) ? TraceDatum.OutHits[0] : FHitResult();
+	LastGroundTraceStart = TraceDatum.Start;
+	bHasGroundTraceResult = true;
+
+	// Make the next GetGroundInfo() pick up the new result
+	CachedGroundInfo.LastUpdateFrame = 0;
 }
 
 const FLyraCharacterGroundInfo& ULyraCharacterMovementComponent::GetGroundInfo()
@@ -62,34 +130,44 @@ const FLyraCharacterGroundInfo& ULyraCharacterMovementComponent::GetGroundInfo()
 	{
 		CachedGroundInfo.GroundHitResult = CurrentFloor.HitResult;
 		CachedGroundInfo.GroundDistance = 0.0f;
+
+		// Any trace from the last time we were airborne is stale now
+		PendingGroundTraceHandle = FTraceHandle();
+		bHasGroundTraceResult = false;
 	}
 	else
 	{
-		const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
-		check(CapsuleComp);
+		const double TimeNow = GetWorld()->GetTimeSeconds();
+		const bool bCanTraceNow = (CharacterOwner->IsLocallyControlled() || (TimeNow >= NextGroundTraceTime));
 
-		const float CapsuleHalfHeight = CapsuleComp->GetUnscaledCapsuleHalfHeight();
-		const ECollisionChannel CollisionChannel = (UpdatedComponent ? UpdatedComponent->GetCollisionObjectType() : ECC_Pawn);
-		const FVector TraceStart(GetActorLocation());
-		const FVector TraceEnd(TraceStart.X, TraceStart.Y, (TraceStart.Z - LyraCharacter::GroundTraceDistance - CapsuleHalfHeight));
-
-		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(LyraCharacterMovementComponent_GetGroundInfo), false, CharacterOwner);
-		FCollisionResponseParams ResponseParam;
-		InitCollisionParams(QueryParams, ResponseParam);
-
-		FHitResult HitResult;
-		GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
+		if (!bHasGroundTraceResult)
+		{
+			// Nothing to extrapolate from yet, so pay for one synchronous trace
+			StartGroundTrace(GetGroundTraceLength(), false);
+			NextGroundTraceTime = TimeNow + LyraCharacter::NonLocalGroundTraceInterval;
+		}
+		else if (bCanTraceNow && !PendingGroundTraceHandle.IsValid())
+		{
+			StartGroundTrace(GetGroundTraceLength(), LyraCharacter::bAsyncGroundTrace);
+			NextGroundTraceTime = TimeNow + LyraCharacter::NonLocalGroundTraceInterval;
+		}
 
-		CachedGroundInfo.GroundHitResult = HitResult;
+		CachedGroundInfo.GroundHitResult = LastGroundTraceHit;
 		CachedGroundInfo.GroundDistance = LyraCharacter::GroundTraceDistance;
 
 		if (MovementMode == MOVE_NavWalking)
 		{
 			CachedGroundInfo.GroundDistance = 0.0f;
 		}
-		else if (HitResult.bBlockingHit)
+		else if (LastGroundTraceHit.bBlockingHit)
 		{
-			CachedGroundInfo.GroundDistance = FMath::Max((HitResult.Distance - CapsuleHalfHeight), 0.0f);
+			const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
+			check(CapsuleComp);
+
+			// The hit may be a frame (or a throttle interval) old, so account for how far we have moved vertically since the trace started
+			const float CapsuleHalfHeight = CapsuleComp->GetUnscaledCapsuleHalfHeight();
+			const float HeightChangeSinceTrace = (LastGroundTraceStart.Z - GetActorLocation().Z);
+			CachedGroundInfo.GroundDistance = FMath::Max((LastGroundTraceHit.Distance - HeightChangeSinceTrace - CapsuleHalfHeight), 0.0f);
 		}
 	}
 
@@ -4,6 +4,7 @@
 
 #include "GameFramework/CharacterMovementComponent.h"
 #include "NativeGameplayTags.h"
+#include "WorldCollision.h"
 
 #include "LyraCharacterMovementComponent.generated.h"
 
@@ -70,11 +71,29 @@ protected:
 
 	virtual void InitializeComponent() override;
 
+	// Returns how far down to trace for ground while airborne, based on how fast we are falling
+	float GetGroundTraceLength() const;
+
+	void StartGroundTrace(float TraceLength, bool bAsync);
+	void HandleGroundTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
 protected:
 
 	// Cached ground info for the character.  Do not access this directly!  It's only updated when accessed via GetGroundInfo().
 	FLyraCharacterGroundInfo CachedGroundInfo;
 
+	// Result of the most recent airborne ground trace and where it started, so the distance can account for movement since it was issued
+	FHitResult LastGroundTraceHit;
+	FVector LastGroundTraceStart = FVector::ZeroVector;
+	bool bHasGroundTraceResult = false;
+
+	// Async ground trace that is still in flight, its result is used the frame after it was issued
+	FTraceHandle PendingGroundTraceHandle;
+	FTraceDelegate GroundTraceDelegate;
+
+	// World time before which non-locally controlled characters reuse their last ground trace
+	double NextGroundTraceTime = 0.0;
+
 	UPROPERTY(Transient)
 	bool bHasReplicatedAcceleration = false;
 };
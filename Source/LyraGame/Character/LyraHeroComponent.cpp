@@ -279,8 +279,7 @@ void ULyraHeroComponent::InitializePlayerInput(UInputComponent* PlayerInputCompo
 
 					// This is where we actually bind and input action to a gameplay tag, which means that Gameplay Ability Blueprints will
 					// be triggered directly by these input actions Triggered events. 
-					TArray<uint32> BindHandles;
-					LyraIC->BindAbilityActions(InputConfig, this, &ThisClass::Input_AbilityInputTagPressed, &ThisClass::Input_AbilityInputTagReleased, /*out*/ BindHandles);
+					LyraIC->AddAbilityActionBindings(InputConfig, this, &ThisClass::Input_AbilityInputTagPressed, &ThisClass::Input_AbilityInputTagReleased);
 
 					LyraIC->BindNativeAction(InputConfig, LyraGameplayTags::InputTag_Move, ETriggerEvent::Triggered, this, &ThisClass::Input_Move, /*bLogIfNotFound=*/ false);
 					LyraIC->BindNativeAction(InputConfig, LyraGameplayTags::InputTag_Look_Mouse, ETriggerEvent::Triggered, this, &ThisClass::Input_LookMouse, /*bLogIfNotFound=*/ false);
@@ -303,36 +302,33 @@ void ULyraHeroComponent::InitializePlayerInput(UInputComponent* PlayerInputCompo
 
 void ULyraHeroComponent::AddAdditionalInputConfig(const ULyraInputConfig* InputConfig)
 {
-	TArray<uint32> BindHandles;
-
 	const APawn* Pawn = GetPawn<APawn>();
-	if (!Pawn)
+	if (!Pawn || !InputConfig)
 	{
 		return;
 	}
-	
-	const APlayerController* PC = GetController<APlayerController>();
-	check(PC);
-
-	const ULocalPlayer* LP = PC->GetLocalPlayer();
-	check(LP);
-
-	UEnhancedInputLocalPlayerSubsystem* Subsystem = LP->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
-	check(Subsystem);
 
-	if (const ULyraPawnExtensionComponent* PawnExtComp = ULyraPawnExtensionComponent::FindPawnExtensionComponent(Pawn))
+	// Only the actions that aren't bound yet get new bindings, the rest just gain a reference
+	ULyraInputComponent* LyraIC = Pawn->FindComponentByClass<ULyraInputComponent>();
+	if (ensureMsgf(LyraIC, TEXT("Unexpected Input Component class! The Gameplay Abilities will not be bound to their inputs. Change the input component to ULyraInputComponent or a subclass of it.")))
 	{
-		ULyraInputComponent* LyraIC = Pawn->FindComponentByClass<ULyraInputComponent>();
-		if (ensureMsgf(LyraIC, TEXT("Unexpected Input Component class! The Gameplay Abilities will not be bound to their inputs. Change the input component to ULyraInputComponent or a subclass of it.")))
-		{
-			LyraIC->BindAbilityActions(InputConfig, this, &ThisClass::Input_AbilityInputTagPressed, &ThisClass::Input_AbilityInputTagReleased, /*out*/ BindHandles);
-		}
+		LyraIC->AddAbilityActionBindings(InputConfig, this, &ThisClass::Input_AbilityInputTagPressed, &ThisClass::Input_AbilityInputTagReleased);
 	}
 }
 
 void ULyraHeroComponent::RemoveAdditionalInputConfig(const ULyraInputConfig* InputConfig)
 {
-	//@TODO: Implement me!
+	const APawn* Pawn = GetPawn<APawn>();
+	if (!Pawn || !InputConfig)
+	{
+		return;
+	}
+
+	// Bindings still used by the pawn's own config or another added config are kept
+	if (ULyraInputComponent* LyraIC = Pawn->FindComponentByClass<ULyraInputComponent>())
+	{
+		LyraIC->RemoveAbilityActionBindings(InputConfig);
+	}
 }
 
 bool ULyraHeroComponent::IsReadyToBindInputs() const
@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Cosmetics/LyraCharacterPartSpawnSubsystem.h"
+
+#include "Cosmetics/LyraPawnComponent_CharacterParts.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "SignificanceManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraCharacterPartSpawnSubsystem)
+
+namespace LyraCharacterPartsCVars
+{
+	static int32 MaxPartSpawnsPerFrame = 4;
+	static FAutoConsoleVariableRef CVarMaxPartSpawnsPerFrame(
+		TEXT("Lyra.CharacterParts.MaxSpawnsPerFrame"),
+		MaxPartSpawnsPerFrame,
+		TEXT("Maximum number of replicated cosmetic character parts spawned per frame (<= 0 spawns them immediately as they replicate)."),
+		ECVF_Default);
+
+	static float SpawnPriorityReferenceDistance = 2000.0f;
+	static FAutoConsoleVariableRef CVarSpawnPriorityReferenceDistance(
+		TEXT("Lyra.CharacterParts.SpawnPriorityReferenceDistance"),
+		SpawnPriorityReferenceDistance,
+		TEXT("Distance (in cm) from the view at which a pawn's distance score for spawning its character parts drops to half."),
+		ECVF_Default);
+}
+
+bool ULyraCharacterPartSpawnSubsystem::IsBudgetedSpawningEnabled()
+{
+	return LyraCharacterPartsCVars::MaxPartSpawnsPerFrame > 0;
+}
+
+void ULyraCharacterPartSpawnSubsystem::RequestSpawnParts(ULyraPawnComponent_CharacterParts* Component)
+{
+	if (Component != nullptr)
+	{
+		PendingComponents.AddUnique(Component);
+	}
+}
+
+bool ULyraCharacterPartSpawnSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Cosmetic parts are never spawned on dedicated servers
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		if (World->GetNetMode() == NM_DedicatedServer)
+		{
+			return false;
+		}
+	}
+
+	return Super::ShouldCreateSubsystem(Outer);
+}
+
+void ULyraCharacterPartSpawnSubsystem::Deinitialize()
+{
+	PendingComponents.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId ULyraCharacterPartSpawnSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULyraCharacterPartSpawnSubsystem, STATGROUP_Tickables);
+}
+
+bool ULyraCharacterPartSpawnSubsystem::IsTickable() const
+{
+	return PendingComponents.Num() > 0;
+}
+
+void ULyraCharacterPartSpawnSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	PendingComponents.RemoveAll([](const TWeakObjectPtr<ULyraPawnComponent_CharacterParts>& Component) { return !Component.IsValid(); });
+	if (PendingComponents.Num() == 0)
+	{
+		return;
+	}
+
+	FVector ViewLocation = FVector::ZeroVector;
+	bool bHasViewLocation = false;
+	if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+	{
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(/*out*/ ViewLocation, /*out*/ ViewRotation);
+		bHasViewLocation = true;
+	}
+
+	// Highest priority last so we can pop from the end
+	PendingComponents.Sort([this, &ViewLocation, bHasViewLocation](const TWeakObjectPtr<ULyraPawnComponent_CharacterParts>& A, const TWeakObjectPtr<ULyraPawnComponent_CharacterParts>& B)
+		{
+			return GetSpawnPriority(A.Get(), ViewLocation, bHasViewLocation) < GetSpawnPriority(B.Get(), ViewLocation, bHasViewLocation);
+		});
+
+	int32 RemainingBudget = FMath::Max(LyraCharacterPartsCVars::MaxPartSpawnsPerFrame, 1);
+	while ((RemainingBudget > 0) && (PendingComponents.Num() > 0))
+	{
+		ULyraPawnComponent_CharacterParts* Component = PendingComponents.Last().Get();
+		RemainingBudget -= Component->SpawnPendingCharacterParts(RemainingBudget);
+
+		if (!Component->HasPendingCharacterParts())
+		{
+			PendingComponents.Pop(EAllowShrinking::No);
+		}
+	}
+}
+
+float ULyraCharacterPartSpawnSubsystem::GetSpawnPriority(const ULyraPawnComponent_CharacterParts* Component, const FVector& ViewLocation, bool bHasViewLocation) const
+{
+	const APawn* Pawn = Component->GetPawn<APawn>();
+	if (Pawn == nullptr)
+	{
+		return 0.0f;
+	}
+
+	// The pawn we're looking through always comes first
+	if (Pawn->IsLocallyControlled())
+	{
+		return UE_BIG_NUMBER;
+	}
+
+	// Both scores are mapped to [0, 1) so they can be combined, higher is more important
+	float TotalScore = 0.0f;
+	int32 NumScores = 0;
+
+	if (const USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		if (const USignificanceManager::FManagedObjectInfo* ObjectInfo = SignificanceManager->GetManagedObject(Pawn))
+		{
+			const float Significance = FMath::Max(ObjectInfo->GetSignificance(), 0.0f);
+			TotalScore += Significance / (1.0f + Significance);
+			++NumScores;
+		}
+	}
+
+	if (bHasViewLocation)
+	{
+		const float Distance = FVector::Dist(Pawn->GetActorLocation(), ViewLocation);
+		const float ReferenceDistance = FMath::Max(LyraCharacterPartsCVars::SpawnPriorityReferenceDistance, 1.0f);
+		TotalScore += 1.0f / (1.0f + (Distance / ReferenceDistance));
+		++NumScores;
+	}
+
+	return (NumScores > 0) ? (TotalScore / NumScores) : 0.0f;
+}
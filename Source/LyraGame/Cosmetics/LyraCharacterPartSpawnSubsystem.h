@@ -0,0 +1,47 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "LyraCharacterPartSpawnSubsystem.generated.h"
+
+class ULyraPawnComponent_CharacterParts;
+
+/**
+ * ULyraCharacterPartSpawnSubsystem
+ *
+ * Spreads the spawning of replicated cosmetic character parts across frames so that receiving
+ * many pawns at once (e.g., when joining a match in progress) doesn't hitch.
+ * Pawns closest to the local view (or most significant) get their parts first.
+ */
+UCLASS()
+class ULyraCharacterPartSpawnSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Returns true if part spawns should be queued through this subsystem rather than done immediately
+	static bool IsBudgetedSpawningEnabled();
+
+	// Queues a component that has parts waiting to be spawned (duplicate requests are ignored)
+	void RequestSpawnParts(ULyraPawnComponent_CharacterParts* Component);
+
+	//~USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override;
+	//~End of FTickableGameObject interface
+
+private:
+	float GetSpawnPriority(const ULyraPawnComponent_CharacterParts* Component, const FVector& ViewLocation, bool bHasViewLocation) const;
+
+private:
+	// Components with parts waiting to be spawned
+	TArray<TWeakObjectPtr<ULyraPawnComponent_CharacterParts>> PendingComponents;
+};
@@ -69,9 +69,14 @@ struct FLyraCharacterPart
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	ECharacterCustomizationCollisionMode CollisionMode = ECharacterCustomizationCollisionMode::NoCollision;
 
-	// Compares against another part, ignoring the collision mode
+	// If true, only the first skeletal mesh component of the part class is instanced and attached (following the parent mesh pose), no actor is spawned.
+	// Use this for purely visual parts that don't need any actor logic, it is much cheaper than spawning a child actor.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bSpawnAsMeshComponent = false;
+
+	// Compares the part class, socket and whether it is spawned as a mesh component (the collision mode is ignored)
 	static bool AreEquivalentParts(const FLyraCharacterPart& A, const FLyraCharacterPart& B)
 	{
-		return (A.PartClass == B.PartClass) && (A.SocketName == B.SocketName);
+		return (A.PartClass == B.PartClass) && (A.SocketName == B.SocketName) && (A.bSpawnAsMeshComponent == B.bSpawnAsMeshComponent);
 	}
 };
@@ -2,10 +2,13 @@
 
 #include "Cosmetics/LyraPawnComponent_CharacterParts.h"
 
+#include "Components/ChildActorComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Cosmetics/LyraCharacterPartSpawnSubsystem.h"
 #include "Cosmetics/LyraCharacterPartTypes.h"
 #include "GameFramework/Character.h"
 #include "GameplayTagAssetInterface.h"
+#include "LyraLogChannels.h"
 #include "Net/UnrealNetwork.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraPawnComponent_CharacterParts)
@@ -37,6 +40,11 @@ void FLyraCharacterPartList::PreReplicatedRemove(const TArrayView<int32> Removed
 	{
 		OwnerComponent->BroadcastChanged();
 	}
+
+	if (OwnerComponent)
+	{
+		OwnerComponent->UpdateFallbackBodyVisibility();
+	}
 }
 
 void FLyraCharacterPartList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
@@ -45,7 +53,7 @@ void FLyraCharacterPartList::PostReplicatedAdd(const TArrayView<int32> AddedIndi
 	for (int32 Index : AddedIndices)
 	{
 		FLyraAppliedCharacterPartEntry& Entry = Entries[Index];
-		bCreatedAnyActors |= SpawnActorForEntry(Entry);
+		bCreatedAnyActors |= RequestSpawnActorForEntry(Entry);
 	}
 
 	if (bCreatedAnyActors && ensure(OwnerComponent))
@@ -64,7 +72,7 @@ void FLyraCharacterPartList::PostReplicatedChange(const TArrayView<int32> Change
 		FLyraAppliedCharacterPartEntry& Entry = Entries[Index];
 
 		bChangedAnyActors |= DestroyActorForEntry(Entry);
-		bChangedAnyActors |= SpawnActorForEntry(Entry);
+		bChangedAnyActors |= RequestSpawnActorForEntry(Entry);
 	}
 
 	if (bChangedAnyActors && ensure(OwnerComponent))
@@ -138,9 +146,17 @@ FGameplayTagContainer FLyraCharacterPartList::CollectCombinedTags() const
 
 	for (const FLyraAppliedCharacterPartEntry& Entry : Entries)
 	{
-		if (Entry.SpawnedComponent != nullptr)
+		if (UChildActorComponent* ChildActorComponent = Cast<UChildActorComponent>(Entry.SpawnedComponent))
+		{
+			if (IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(ChildActorComponent->GetChildActor()))
+			{
+				TagInterface->GetOwnedGameplayTags(/*inout*/ Result);
+			}
+		}
+		else if ((Entry.SpawnedComponent != nullptr) && (Entry.Part.PartClass != nullptr))
 		{
-			if (IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Entry.SpawnedComponent->GetChildActor()))
+			// Mesh-only parts have no actor instance, so use the tags from the part class defaults
+			if (IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Entry.Part.PartClass->GetDefaultObject()))
 			{
 				TagInterface->GetOwnedGameplayTags(/*inout*/ Result);
 			}
@@ -150,10 +166,63 @@ FGameplayTagContainer FLyraCharacterPartList::CollectCombinedTags() const
 	return Result;
 }
 
+bool FLyraCharacterPartList::RequestSpawnActorForEntry(FLyraAppliedCharacterPartEntry& Entry)
+{
+	if (ensure(OwnerComponent) && !OwnerComponent->IsNetMode(NM_DedicatedServer) && (Entry.Part.PartClass != nullptr))
+	{
+		if (ULyraCharacterPartSpawnSubsystem::IsBudgetedSpawningEnabled())
+		{
+			if (ULyraCharacterPartSpawnSubsystem* SpawnSubsystem = UWorld::GetSubsystem<ULyraCharacterPartSpawnSubsystem>(OwnerComponent->GetWorld()))
+			{
+				Entry.bSpawnPending = true;
+				SpawnSubsystem->RequestSpawnParts(OwnerComponent);
+				OwnerComponent->UpdateFallbackBodyVisibility();
+				return false;
+			}
+		}
+	}
+
+	return SpawnActorForEntry(Entry);
+}
+
+int32 FLyraCharacterPartList::SpawnPendingEntries(int32 MaxToSpawn)
+{
+	int32 NumSpawned = 0;
+	bool bCreatedAnyActors = false;
+
+	for (FLyraAppliedCharacterPartEntry& Entry : Entries)
+	{
+		if (NumSpawned >= MaxToSpawn)
+		{
+			break;
+		}
+
+		if (Entry.bSpawnPending)
+		{
+			bCreatedAnyActors |= SpawnActorForEntry(Entry);
+			++NumSpawned;
+		}
+	}
+
+	if (bCreatedAnyActors && ensure(OwnerComponent))
+	{
+		OwnerComponent->BroadcastChanged();
+	}
+
+	return NumSpawned;
+}
+
+bool FLyraCharacterPartList::HasPendingEntries() const
+{
+	return Entries.ContainsByPredicate([](const FLyraAppliedCharacterPartEntry& Entry) { return Entry.bSpawnPending; });
+}
+
 bool FLyraCharacterPartList::SpawnActorForEntry(FLyraAppliedCharacterPartEntry& Entry)
 {
 	bool bCreatedAnyActors = false;
 
+	Entry.bSpawnPending = false;
+
 	if (ensure(OwnerComponent) && !OwnerComponent->IsNetMode(NM_DedicatedServer))
 	{
 		if (Entry.Part.PartClass != nullptr)
@@ -162,6 +231,11 @@ bool FLyraCharacterPartList::SpawnActorForEntry(FLyraAppliedCharacterPartEntry&
 
 			if (USceneComponent* ComponentToAttachTo = OwnerComponent->GetSceneComponentToAttachTo())
 			{
+				if (Entry.Part.bSpawnAsMeshComponent && SpawnMeshComponentForEntry(Entry, ComponentToAttachTo))
+				{
+					return true;
+				}
+
 				const FTransform SpawnTransform = ComponentToAttachTo->GetSocketTransform(Entry.Part.SocketName);
 
 				UChildActorComponent* PartComponent = NewObject<UChildActorComponent>(OwnerComponent->GetOwner());
@@ -199,10 +273,56 @@ bool FLyraCharacterPartList::SpawnActorForEntry(FLyraAppliedCharacterPartEntry&
 	return bCreatedAnyActors;
 }
 
+bool FLyraCharacterPartList::SpawnMeshComponentForEntry(FLyraAppliedCharacterPartEntry& Entry, USceneComponent* ComponentToAttachTo)
+{
+	// Find the mesh in the part class defaults (including components added in the Blueprint)
+	const USkeletalMeshComponent* TemplateMeshComponent = nullptr;
+	AActor::ForEachComponentOfActorClassDefault(Entry.Part.PartClass, USkeletalMeshComponent::StaticClass(), [&TemplateMeshComponent](const UActorComponent* TemplateComponent)
+		{
+			TemplateMeshComponent = CastChecked<USkeletalMeshComponent>(TemplateComponent);
+			return false;
+		});
+
+	if (TemplateMeshComponent == nullptr)
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Character part %s is set to spawn as a mesh component but has no skeletal mesh component, spawning it as an actor instead"), *GetPathNameSafe(Entry.Part.PartClass));
+		return false;
+	}
+
+	USkeletalMeshComponent* PartComponent = NewObject<USkeletalMeshComponent>(OwnerComponent->GetOwner(), NAME_None, RF_Transient, const_cast<USkeletalMeshComponent*>(TemplateMeshComponent));
+	PartComponent->SetupAttachment(ComponentToAttachTo, Entry.Part.SocketName);
+	PartComponent->SetRelativeTransform(FTransform::Identity);
+
+	switch (Entry.Part.CollisionMode)
+	{
+	case ECharacterCustomizationCollisionMode::UseCollisionFromCharacterPart:
+		// Do nothing
+		break;
+
+	case ECharacterCustomizationCollisionMode::NoCollision:
+		PartComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		break;
+	}
+
+	PartComponent->RegisterComponent();
+
+	// Without an actor running its own logic, the part follows the pose of the mesh it is attached to
+	if (USkeletalMeshComponent* ParentMeshComponent = Cast<USkeletalMeshComponent>(ComponentToAttachTo))
+	{
+		PartComponent->SetLeaderPoseComponent(ParentMeshComponent);
+	}
+	PartComponent->AddTickPrerequisiteComponent(ComponentToAttachTo);
+
+	Entry.SpawnedComponent = PartComponent;
+	return true;
+}
+
 bool FLyraCharacterPartList::DestroyActorForEntry(FLyraAppliedCharacterPartEntry& Entry)
 {
 	bool bDestroyedAnyActors = false;
 
+	Entry.bSpawnPending = false;
+
 	if (Entry.SpawnedComponent != nullptr)
 	{
 		Entry.SpawnedComponent->DestroyComponent();
@@ -272,7 +392,7 @@ TArray<AActor*> ULyraPawnComponent_CharacterParts::GetCharacterPartActors() cons
 
 	for (const FLyraAppliedCharacterPartEntry& Entry : CharacterPartList.Entries)
 	{
-		if (UChildActorComponent* PartComponent = Entry.SpawnedComponent)
+		if (UChildActorComponent* PartComponent = Cast<UChildActorComponent>(Entry.SpawnedComponent))
 		{
 			if (AActor* SpawnedActor = PartComponent->GetChildActor())
 			{
@@ -284,6 +404,22 @@ TArray<AActor*> ULyraPawnComponent_CharacterParts::GetCharacterPartActors() cons
 	return Result;
 }
 
+TArray<USceneComponent*> ULyraPawnComponent_CharacterParts::GetCharacterPartComponents() const
+{
+	TArray<USceneComponent*> Result;
+	Result.Reserve(CharacterPartList.Entries.Num());
+
+	for (const FLyraAppliedCharacterPartEntry& Entry : CharacterPartList.Entries)
+	{
+		if (Entry.SpawnedComponent != nullptr)
+		{
+			Result.Add(Entry.SpawnedComponent);
+		}
+	}
+
+	return Result;
+}
+
 USkeletalMeshComponent* ULyraPawnComponent_CharacterParts::GetParentMeshComponent() const
 {
 	if (AActor* OwnerActor = GetOwner())
@@ -329,6 +465,40 @@ FGameplayTagContainer ULyraPawnComponent_CharacterParts::GetCombinedTags(FGamepl
 	}
 }
 
+int32 ULyraPawnComponent_CharacterParts::SpawnPendingCharacterParts(int32 MaxToSpawn)
+{
+	const int32 NumSpawned = CharacterPartList.SpawnPendingEntries(MaxToSpawn);
+	UpdateFallbackBodyVisibility();
+	return NumSpawned;
+}
+
+bool ULyraPawnComponent_CharacterParts::HasPendingCharacterParts() const
+{
+	return CharacterPartList.HasPendingEntries();
+}
+
+void ULyraPawnComponent_CharacterParts::UpdateFallbackBodyVisibility()
+{
+	USkeletalMeshComponent* MeshComponent = GetParentMeshComponent();
+	if (MeshComponent == nullptr)
+	{
+		return;
+	}
+
+	const bool bWantsFallbackBody = bShowParentMeshUntilPartsSpawned && HasPendingCharacterParts();
+	if (bWantsFallbackBody && !bShowingFallbackBody)
+	{
+		bParentMeshWasHiddenInGame = MeshComponent->bHiddenInGame;
+		MeshComponent->SetHiddenInGame(false);
+		bShowingFallbackBody = true;
+	}
+	else if (!bWantsFallbackBody && bShowingFallbackBody)
+	{
+		MeshComponent->SetHiddenInGame(bParentMeshWasHiddenInGame);
+		bShowingFallbackBody = false;
+	}
+}
+
 void ULyraPawnComponent_CharacterParts::BroadcastChanged()
 {
 	const bool bReinitPose = true;
@@ -50,9 +50,13 @@ private:
 	UPROPERTY(NotReplicated)
 	int32 PartHandle = INDEX_NONE;
 
-	// The spawned actor instance (client only)
+	// The spawned child actor component, or the skeletal mesh component for parts using bSpawnAsMeshComponent (client only)
 	UPROPERTY(NotReplicated)
-	TObjectPtr<UChildActorComponent> SpawnedComponent = nullptr;
+	TObjectPtr<USceneComponent> SpawnedComponent = nullptr;
+
+	// Waiting for ULyraCharacterPartSpawnSubsystem to spawn this part (client only)
+	UPROPERTY(NotReplicated)
+	bool bSpawnPending = false;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -94,9 +98,16 @@ public:
 private:
 	friend ULyraPawnComponent_CharacterParts;
 
+	// Spawns the part now, or queues it with the spawn subsystem if budgeted spawning is enabled. Returns true if anything was spawned immediately.
+	bool RequestSpawnActorForEntry(FLyraAppliedCharacterPartEntry& Entry);
 	bool SpawnActorForEntry(FLyraAppliedCharacterPartEntry& Entry);
+	bool SpawnMeshComponentForEntry(FLyraAppliedCharacterPartEntry& Entry, USceneComponent* ComponentToAttachTo);
 	bool DestroyActorForEntry(FLyraAppliedCharacterPartEntry& Entry);
 
+	// Spawns up to MaxToSpawn pending parts, returning the number spawned
+	int32 SpawnPendingEntries(int32 MaxToSpawn);
+	bool HasPendingEntries() const;
+
 private:
 	// Replicated list of equipment entries
 	UPROPERTY()
@@ -145,10 +156,15 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category=Cosmetics)
 	void RemoveAllCharacterParts();
 
-	// Gets the list of all spawned character parts from this component
+	// Gets the list of all spawned character part actors from this component
+	// Parts using bSpawnAsMeshComponent have no actor, use GetCharacterPartComponents to include them
 	UFUNCTION(BlueprintCallable, BlueprintPure=false, BlueprintCosmetic, Category=Cosmetics)
 	TArray<AActor*> GetCharacterPartActors() const;
 
+	// Gets the list of all spawned character parts from this component, the child actor component for actor parts or the mesh component for mesh-only parts
+	UFUNCTION(BlueprintCallable, BlueprintPure=false, BlueprintCosmetic, Category=Cosmetics)
+	TArray<USceneComponent*> GetCharacterPartComponents() const;
+
 	// If the parent actor is derived from ACharacter, returns the Mesh component, otherwise nullptr
 	USkeletalMeshComponent* GetParentMeshComponent() const;
 
@@ -162,6 +178,15 @@ public:
 
 	void BroadcastChanged();
 
+	// Spawns up to MaxToSpawn parts that were queued with ULyraCharacterPartSpawnSubsystem, returning the number spawned
+	int32 SpawnPendingCharacterParts(int32 MaxToSpawn);
+
+	// Returns true if any replicated parts are still waiting to be spawned
+	bool HasPendingCharacterParts() const;
+
+	// Shows or restores the parent mesh depending on whether parts are still pending (see bShowParentMeshUntilPartsSpawned)
+	void UpdateFallbackBodyVisibility();
+
 public:
 	// Delegate that will be called when the list of spawned character parts has changed
 	UPROPERTY(BlueprintAssignable, Category=Cosmetics, BlueprintCallable)
@@ -175,4 +200,11 @@ private:
 	// Rules for how to pick a body style mesh for animation to play on, based on character part cosmetics tags
 	UPROPERTY(EditAnywhere, Category=Cosmetics)
 	FLyraAnimBodyStyleSelectionSet BodyMeshes;
+
+	// If true, the parent mesh is made visible while replicated parts are waiting to be spawned, so the pawn isn't invisible in the meantime
+	UPROPERTY(EditAnywhere, Category=Cosmetics)
+	bool bShowParentMeshUntilPartsSpawned = false;
+
+	bool bShowingFallbackBody = false;
+	bool bParentMeshWasHiddenInGame = false;
 };
@@ -4,9 +4,21 @@
 #include "GameModes/LyraExperienceManager.h"
 #include "Engine/Engine.h"
 #include "Subsystems/SubsystemCollection.h"
+#include "GameFeaturesSubsystem.h"
+#include "LyraLogChannels.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraExperienceManager)
 
+namespace LyraConsoleVariables
+{
+	static bool bExperienceWarmCache = false;
+	static FAutoConsoleVariableRef CVarExperienceWarmCache(
+		TEXT("Lyra.Experience.WarmCache"),
+		bExperienceWarmCache,
+		TEXT("If true, game feature plugins and loaded assets of an experience are kept across travel and only the difference is deactivated/activated when the next experience starts (not used in the editor)"),
+		ECVF_Default);
+}
+
 #if WITH_EDITOR
 
 void ULyraExperienceManager::OnPlayInEditorBegun()
@@ -52,3 +64,57 @@ bool ULyraExperienceManager::RequestToDeactivatePlugin(const FString PluginURL)
 }
 
 #endif
+
+bool ULyraExperienceManager::IsWarmCacheEnabled()
+{
+	// PIE sessions arbitrate plugin activation through GameFeaturePluginRequestCountMap instead
+	return LyraConsoleVariables::bExperienceWarmCache && !GIsEditor;
+}
+
+void ULyraExperienceManager::StoreWarmExperienceState(const TArray<FString>& ActivePluginURLs, TArray<TSharedPtr<FStreamableHandle>>&& Handles)
+{
+	// Anything still cached was never claimed, so it is still active and gets merged into the new state
+	for (const FString& PluginURL : ActivePluginURLs)
+	{
+		WarmGameFeaturePluginURLs.AddUnique(PluginURL);
+	}
+
+	for (TSharedPtr<FStreamableHandle>& Handle : Handles)
+	{
+		if (Handle.IsValid())
+		{
+			WarmHandles.Add(MoveTemp(Handle));
+		}
+	}
+
+	UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: Keeping %d game feature plugin(s) and %d handle(s) warm for the next experience"), WarmGameFeaturePluginURLs.Num(), WarmHandles.Num());
+}
+
+TSet<FString> ULyraExperienceManager::ClaimWarmExperienceState(const TArray<FString>& RequiredPluginURLs, TArray<TSharedPtr<FStreamableHandle>>& OutHandles)
+{
+	TSet<FString> StillActivePluginURLs;
+
+	for (const FString& PluginURL : WarmGameFeaturePluginURLs)
+	{
+		if (RequiredPluginURLs.Contains(PluginURL))
+		{
+			StillActivePluginURLs.Add(PluginURL);
+		}
+		else
+		{
+			UGameFeaturesSubsystem::Get().DeactivateGameFeaturePlugin(PluginURL);
+		}
+	}
+
+	if (WarmGameFeaturePluginURLs.Num() > 0)
+	{
+		UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: Reusing %d of %d warm game feature plugin(s)"), StillActivePluginURLs.Num(), WarmGameFeaturePluginURLs.Num());
+	}
+
+	WarmGameFeaturePluginURLs.Reset();
+
+	OutHandles.Append(MoveTemp(WarmHandles));
+	WarmHandles.Reset();
+
+	return StillActivePluginURLs;
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Subsystems/EngineSubsystem.h"
+#include "Engine/StreamableManager.h"
 #include "LyraExperienceManager.generated.h"
 
 /**
@@ -24,6 +25,23 @@ public:
 	static bool RequestToDeactivatePlugin(const FString PluginURL) { return true; }
 #endif
 
+	// Returns true if an ending experience should leave its game feature plugins active and its assets loaded for the next one (Lyra.Experience.WarmCache)
+	static bool IsWarmCacheEnabled();
+
+	// Called when an experience ends with the warm cache enabled, keeping its plugins active and handles alive until the next experience claims them
+	void StoreWarmExperienceState(const TArray<FString>& ActivePluginURLs, TArray<TSharedPtr<FStreamableHandle>>&& Handles);
+
+	// Called when a new experience starts loading. Deactivates any cached plugins it does not need and returns the ones that are still active.
+	// The cached handles are moved into OutHandles so the caller can keep the assets resident until its own loads complete.
+	TSet<FString> ClaimWarmExperienceState(const TArray<FString>& RequiredPluginURLs, TArray<TSharedPtr<FStreamableHandle>>& OutHandles);
+
+private:
+	// Plugins left active by the previous experience
+	TArray<FString> WarmGameFeaturePluginURLs;
+
+	// Definition and bundle handles of the previous experience
+	TArray<TSharedPtr<FStreamableHandle>> WarmHandles;
+
 private:
 	// The map of requests to active count for a given game feature plugin
 	// (to allow first in, last out activation management during PIE)
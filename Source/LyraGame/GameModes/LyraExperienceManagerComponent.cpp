@@ -1,7 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LyraExperienceManagerComponent.h"
+#include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
 #include "Net/UnrealNetwork.h"
 #include "LyraExperienceDefinition.h"
 #include "LyraExperienceActionSet.h"
@@ -11,18 +13,20 @@
 #include "GameFeatureAction.h"
 #include "GameFeaturesSubsystemSettings.h"
 #include "TimerManager.h"
+#include "GameFramework/GameplayMessageSubsystem.h"
+#include "NativeGameplayTags.h"
 #include "Settings/LyraSettingsLocal.h"
 #include "LyraLogChannels.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraExperienceManagerComponent)
 
-//@TODO: Async load the experience definition itself
 //@TODO: Handle failures explicitly (go into a 'completed but failed' state rather than check()-ing)
 //@TODO: Do the action phases at the appropriate times instead of all at once
 //@TODO: Support deactivating an experience and do the unloading actions
 //@TODO: Think about what deactivation/cleanup means for preloaded assets
 //@TODO: Handle deactivating game features, right now we 'leak' them enabled
-// (for a client moving from experience to experience we actually want to diff the requirements and only unload some, not unload everything for them to just be immediately reloaded)
+// (for a client moving from experience to experience we actually want to diff the requirements and only unload some, not unload everything for them to just be immediately reloaded,
+//  Lyra.Experience.WarmCache does this but is currently opt-in)
 //@TODO: Handle both built-in and URL-based plugins (search for colon?)
 
 namespace LyraConsoleVariables
@@ -45,8 +49,17 @@ namespace LyraConsoleVariables
 	{
 		return FMath::Max(0.0f, ExperienceLoadRandomDelayMin + FMath::FRand() * ExperienceLoadRandomDelayRange);
 	}
+
+	static bool bOverlapGameFeatureActivation = true;
+	static FAutoConsoleVariableRef CVarOverlapGameFeatureActivation(
+		TEXT("Lyra.Experience.OverlapGameFeatureActivation"),
+		bOverlapGameFeatureActivation,
+		TEXT("If true, game feature plugins for an experience are loaded and activated while its asset bundles are still loading, rather than afterwards"),
+		ECVF_Default);
 }
 
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Experience_Message_LoadTimings, "Lyra.Experience.Message.LoadTimings");
+
 ULyraExperienceManagerComponent::ULyraExperienceManagerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -55,10 +68,36 @@ ULyraExperienceManagerComponent::ULyraExperienceManagerComponent(const FObjectIn
 
 void ULyraExperienceManagerComponent::SetCurrentExperience(FPrimaryAssetId ExperienceId)
 {
+	check(CurrentExperience == nullptr);
+	check(LoadState == ELyraExperienceLoadState::Unloaded);
+
 	ULyraAssetManager& AssetManager = ULyraAssetManager::Get();
 	FSoftObjectPath AssetPath = AssetManager.GetPrimaryAssetPath(ExperienceId);
-	TSubclassOf<ULyraExperienceDefinition> AssetClass = Cast<UClass>(AssetPath.TryLoad());
-	check(AssetClass);
+
+	LoadState = ELyraExperienceLoadState::LoadingDefinition;
+	LoadRequestTime = FPlatformTime::Seconds();
+
+	DefinitionLoadHandle = AssetManager.GetStreamableManager().RequestAsyncLoad(AssetPath,
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnExperienceDefinitionLoaded, ExperienceId, AssetPath),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (!DefinitionLoadHandle.IsValid())
+	{
+		// Nothing to load (or the request failed outright), resolve now so the failure is reported below
+		OnExperienceDefinitionLoaded(ExperienceId, AssetPath);
+	}
+}
+
+void ULyraExperienceManagerComponent::OnExperienceDefinitionLoaded(FPrimaryAssetId ExperienceId, FSoftObjectPath AssetPath)
+{
+	if (LoadState != ELyraExperienceLoadState::LoadingDefinition)
+	{
+		// Torn down (or already handled) while the definition was loading
+		return;
+	}
+
+	TSubclassOf<ULyraExperienceDefinition> AssetClass = Cast<UClass>(AssetPath.ResolveObject());
+	checkf(AssetClass, TEXT("Failed to load experience definition %s (%s)"), *ExperienceId.ToString(), *AssetPath.ToString());
 	const ULyraExperienceDefinition* Experience = GetDefault<ULyraExperienceDefinition>(AssetClass);
 
 	check(Experience != nullptr);
@@ -115,6 +154,81 @@ bool ULyraExperienceManagerComponent::IsExperienceLoaded() const
 	return (LoadState == ELyraExperienceLoadState::Loaded) && (CurrentExperience != nullptr);
 }
 
+float ULyraExperienceManagerComponent::GetExperienceLoadProgress() const
+{
+	// FStreamableHandle::GetProgress traverses the whole request graph, so only refresh the estimate periodically or when the phase changes
+	const double ProgressRefreshInterval = 0.1;
+
+	const double Now = FPlatformTime::Seconds();
+	if ((CachedLoadProgressTime < 0.0) || (CachedLoadProgressState != LoadState) || ((Now - CachedLoadProgressTime) >= ProgressRefreshInterval))
+	{
+		CachedLoadProgress = ComputeExperienceLoadProgress();
+		CachedLoadProgressTime = Now;
+		CachedLoadProgressState = LoadState;
+	}
+
+	return CachedLoadProgress;
+}
+
+float ULyraExperienceManagerComponent::GetExperienceLoadProgressForWorld(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	const ULyraExperienceManagerComponent* ExperienceComponent = GameState ? GameState->FindComponentByClass<ULyraExperienceManagerComponent>() : nullptr;
+
+	return ExperienceComponent ? ExperienceComponent->GetExperienceLoadProgress() : 0.0f;
+}
+
+float ULyraExperienceManagerComponent::ComputeExperienceLoadProgress() const
+{
+	// Rough weights for each phase, bundles and game features load concurrently so they share the middle of the range
+	const float DefinitionWeight = 0.1f;
+	const float BundleWeight = 0.5f;
+	const float GameFeatureWeight = 0.3f;
+
+	switch (LoadState)
+	{
+	case ELyraExperienceLoadState::Unloaded:
+		return 0.0f;
+	case ELyraExperienceLoadState::LoadingDefinition:
+		return DefinitionLoadHandle.IsValid() ? (DefinitionLoadHandle->GetProgress() * DefinitionWeight) : 0.0f;
+	case ELyraExperienceLoadState::Loading:
+	case ELyraExperienceLoadState::LoadingGameFeatures:
+	{
+		float Progress = DefinitionWeight;
+
+		if (bExperienceBundlesLoaded)
+		{
+			Progress += BundleWeight;
+		}
+		else if (BundleLoadHandle.IsValid())
+		{
+			Progress += BundleLoadHandle->GetProgress() * BundleWeight;
+		}
+
+		if (GameFeaturePluginURLs.Num() > 0)
+		{
+			const int32 NumGameFeaturePluginsLoaded = bGameFeaturePluginLoadsStarted ? (GameFeaturePluginURLs.Num() - NumGameFeaturePluginsLoading) : 0;
+			Progress += GameFeatureWeight * (float)NumGameFeaturePluginsLoaded / (float)GameFeaturePluginURLs.Num();
+		}
+		else if (bGameFeaturePluginLoadsStarted)
+		{
+			Progress += GameFeatureWeight;
+		}
+
+		return Progress;
+	}
+	case ELyraExperienceLoadState::LoadingChaosTestingDelay:
+	case ELyraExperienceLoadState::ExecutingActions:
+		return DefinitionWeight + BundleWeight + GameFeatureWeight;
+	case ELyraExperienceLoadState::Loaded:
+	case ELyraExperienceLoadState::Deactivating:
+		return 1.0f;
+	}
+
+	return 0.0f;
+}
+
 void ULyraExperienceManagerComponent::OnRep_CurrentExperience()
 {
 	StartExperienceLoad();
@@ -123,13 +237,38 @@ void ULyraExperienceManagerComponent::OnRep_CurrentExperience()
 void ULyraExperienceManagerComponent::StartExperienceLoad()
 {
 	check(CurrentExperience != nullptr);
-	check(LoadState == ELyraExperienceLoadState::Unloaded);
+	check((LoadState == ELyraExperienceLoadState::Unloaded) || (LoadState == ELyraExperienceLoadState::LoadingDefinition));
 
 	UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: StartExperienceLoad(CurrentExperience = %s, %s)"),
 		*CurrentExperience->GetPrimaryAssetId().ToString(),
 		*GetClientServerContextString(this));
 
 	LoadState = ELyraExperienceLoadState::Loading;
+	LoadStartTime = FPlatformTime::Seconds();
+	if (LoadRequestTime == 0.0)
+	{
+		// Clients receive the definition via replication, so there is no definition load phase
+		LoadRequestTime = LoadStartTime;
+	}
+
+	bExperienceBundlesLoaded = false;
+	bGameFeaturePluginLoadsStarted = false;
+
+	// The action sets (and so the plugin list) are hard references of the definition, so plugins can start loading alongside the bundles
+	CollectGameFeaturePluginURLs();
+
+	WarmGameFeaturePluginURLs.Reset();
+	if (ULyraExperienceManager::IsWarmCacheEnabled())
+	{
+		ULyraExperienceManager* ExperienceManagerSubsystem = GEngine->GetEngineSubsystem<ULyraExperienceManager>();
+		check(ExperienceManagerSubsystem);
+		WarmGameFeaturePluginURLs = ExperienceManagerSubsystem->ClaimWarmExperienceState(GameFeaturePluginURLs, /*out*/ WarmCacheHandles);
+	}
+
+	if (LyraConsoleVariables::bOverlapGameFeatureActivation)
+	{
+		StartGameFeaturePluginLoads();
+	}
 
 	ULyraAssetManager& AssetManager = ULyraAssetManager::Get();
 
@@ -163,10 +302,10 @@ void ULyraExperienceManagerComponent::StartExperienceLoad()
 		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateServer);
 	}
 
-	TSharedPtr<FStreamableHandle> BundleLoadHandle = nullptr;
+	TSharedPtr<FStreamableHandle> BundleStateLoadHandle = nullptr;
 	if (BundleAssetList.Num() > 0)
 	{
-		BundleLoadHandle = AssetManager.ChangeBundleStateForPrimaryAssets(BundleAssetList.Array(), BundlesToLoad, {}, false, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		BundleStateLoadHandle = AssetManager.ChangeBundleStateForPrimaryAssets(BundleAssetList.Array(), BundlesToLoad, {}, false, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
 	}
 
 	TSharedPtr<FStreamableHandle> RawLoadHandle = nullptr;
@@ -177,15 +316,17 @@ void ULyraExperienceManagerComponent::StartExperienceLoad()
 
 	// If both async loads are running, combine them
 	TSharedPtr<FStreamableHandle> Handle = nullptr;
-	if (BundleLoadHandle.IsValid() && RawLoadHandle.IsValid())
+	if (BundleStateLoadHandle.IsValid() && RawLoadHandle.IsValid())
 	{
-		Handle = AssetManager.GetStreamableManager().CreateCombinedHandle({ BundleLoadHandle, RawLoadHandle });
+		Handle = AssetManager.GetStreamableManager().CreateCombinedHandle({ BundleStateLoadHandle, RawLoadHandle });
 	}
 	else
 	{
-		Handle = BundleLoadHandle.IsValid() ? BundleLoadHandle : RawLoadHandle;
+		Handle = BundleStateLoadHandle.IsValid() ? BundleStateLoadHandle : RawLoadHandle;
 	}
 
+	BundleLoadHandle = Handle;
+
 	FStreamableDelegate OnAssetsLoadedDelegate = FStreamableDelegate::CreateUObject(this, &ThisClass::OnExperienceLoadComplete);
 	if (!Handle.IsValid() || Handle->HasLoadCompleted())
 	{
@@ -211,15 +352,8 @@ void ULyraExperienceManagerComponent::StartExperienceLoad()
 	}
 }
 
-void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
+void ULyraExperienceManagerComponent::CollectGameFeaturePluginURLs()
 {
-	check(LoadState == ELyraExperienceLoadState::Loading);
-	check(CurrentExperience != nullptr);
-
-	UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: OnExperienceLoadComplete(CurrentExperience = %s, %s)"),
-		*CurrentExperience->GetPrimaryAssetId().ToString(),
-		*GetClientServerContextString(this));
-
 	// find the URLs for our GameFeaturePlugins - filtering out dupes and ones that don't have a valid mapping
 	GameFeaturePluginURLs.Reset();
 
@@ -234,7 +368,7 @@ void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
 			}
 			else
 			{
-				ensureMsgf(false, TEXT("OnExperienceLoadComplete failed to find plugin URL from PluginName %s for experience %s - fix data, ignoring for this run"), *PluginName, *Context->GetPrimaryAssetId().ToString());
+				ensureMsgf(false, TEXT("CollectGameFeaturePluginURLs failed to find plugin URL from PluginName %s for experience %s - fix data, ignoring for this run"), *PluginName, *Context->GetPrimaryAssetId().ToString());
 			}
 		}
 
@@ -257,22 +391,69 @@ void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
 			CollectGameFeaturePluginURLs(ActionSet, ActionSet->GameFeaturesToEnable);
 		}
 	}
+}
 
-	// Load and activate the features	
+void ULyraExperienceManagerComponent::StartGameFeaturePluginLoads()
+{
+	check(!bGameFeaturePluginLoadsStarted);
+	bGameFeaturePluginLoadsStarted = true;
+
+	// Load and activate the features
 	NumGameFeaturePluginsLoading = GameFeaturePluginURLs.Num();
 	if (NumGameFeaturePluginsLoading > 0)
 	{
-		LoadState = ELyraExperienceLoadState::LoadingGameFeatures;
-		for (const FString& PluginURL : GameFeaturePluginURLs)
+		// Copy the list, completion callbacks can fire synchronously for plugins that are already active
+		const TArray<FString> PluginURLsToLoad = GameFeaturePluginURLs;
+		for (const FString& PluginURL : PluginURLsToLoad)
 		{
+			if (WarmGameFeaturePluginURLs.Contains(PluginURL))
+			{
+				// Still active from the previous experience
+				--NumGameFeaturePluginsLoading;
+				continue;
+			}
+
 			ULyraExperienceManager::NotifyOfPluginActivation(PluginURL);
 			UGameFeaturesSubsystem::Get().LoadAndActivateGameFeaturePlugin(PluginURL, FGameFeaturePluginLoadComplete::CreateUObject(this, &ThisClass::OnGameFeaturePluginLoadComplete));
 		}
 	}
-	else
+
+	if (NumGameFeaturePluginsLoading == 0)
 	{
-		OnExperienceFullLoadCompleted();
+		GameFeaturesLoadedTime = FPlatformTime::Seconds();
+	}
+}
+
+void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
+{
+	check(LoadState == ELyraExperienceLoadState::Loading);
+	check(CurrentExperience != nullptr);
+
+	UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: OnExperienceLoadComplete(CurrentExperience = %s, %s)"),
+		*CurrentExperience->GetPrimaryAssetId().ToString(),
+		*GetClientServerContextString(this));
+
+	bExperienceBundlesLoaded = true;
+	BundlesLoadedTime = FPlatformTime::Seconds();
+
+	// Our own handles now keep everything we need resident
+	for (const TSharedPtr<FStreamableHandle>& Handle : WarmCacheHandles)
+	{
+		Handle->ReleaseHandle();
+	}
+	WarmCacheHandles.Reset();
+
+	if (!bGameFeaturePluginLoadsStarted)
+	{
+		StartGameFeaturePluginLoads();
 	}
+
+	if (NumGameFeaturePluginsLoading > 0)
+	{
+		LoadState = ELyraExperienceLoadState::LoadingGameFeatures;
+	}
+
+	TryCompleteExperienceLoad();
 }
 
 void ULyraExperienceManagerComponent::OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result)
@@ -281,6 +462,17 @@ void ULyraExperienceManagerComponent::OnGameFeaturePluginLoadComplete(const UE::
 	NumGameFeaturePluginsLoading--;
 
 	if (NumGameFeaturePluginsLoading == 0)
+	{
+		GameFeaturesLoadedTime = FPlatformTime::Seconds();
+		TryCompleteExperienceLoad();
+	}
+}
+
+void ULyraExperienceManagerComponent::TryCompleteExperienceLoad()
+{
+	// Bundles and plugins may finish in either order, only continue once both are done
+	if (bExperienceBundlesLoaded && bGameFeaturePluginLoadsStarted && (NumGameFeaturePluginsLoading == 0)
+		&& ((LoadState == ELyraExperienceLoadState::Loading) || (LoadState == ELyraExperienceLoadState::LoadingGameFeatures)))
 	{
 		OnExperienceFullLoadCompleted();
 	}
@@ -306,6 +498,7 @@ void ULyraExperienceManagerComponent::OnExperienceFullLoadCompleted()
 	}
 
 	LoadState = ELyraExperienceLoadState::ExecutingActions;
+	ExecuteActionsStartTime = FPlatformTime::Seconds();
 
 	// Execute the actions
 	FGameFeatureActivatingContext Context;
@@ -344,6 +537,8 @@ void ULyraExperienceManagerComponent::OnExperienceFullLoadCompleted()
 
 	LoadState = ELyraExperienceLoadState::Loaded;
 
+	BroadcastLoadTimings();
+
 	OnExperienceLoaded_HighPriority.Broadcast(CurrentExperience);
 	OnExperienceLoaded_HighPriority.Clear();
 
@@ -359,6 +554,33 @@ void ULyraExperienceManagerComponent::OnExperienceFullLoadCompleted()
 #endif
 }
 
+void ULyraExperienceManagerComponent::BroadcastLoadTimings()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FLyraExperienceLoadTimingsMessage Message;
+	Message.ExperienceId = CurrentExperience->GetPrimaryAssetId();
+	Message.DefinitionLoadSeconds = (float)(LoadStartTime - LoadRequestTime);
+	Message.BundleLoadSeconds = (float)(BundlesLoadedTime - LoadStartTime);
+	Message.GameFeatureActivationSeconds = (float)(FMath::Max(GameFeaturesLoadedTime, LoadStartTime) - LoadStartTime);
+	Message.ExecuteActionsSeconds = (float)(Now - ExecuteActionsStartTime);
+	Message.TotalSeconds = (float)(Now - LoadRequestTime);
+	Message.NumGameFeaturePlugins = GameFeaturePluginURLs.Num();
+
+	UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: LoadTimings(Experience = %s, Definition = %.3f, Bundles = %.3f, GameFeatures = %.3f (%d plugins), Actions = %.3f, Total = %.3f, %s)"),
+		*Message.ExperienceId.ToString(),
+		Message.DefinitionLoadSeconds,
+		Message.BundleLoadSeconds,
+		Message.GameFeatureActivationSeconds,
+		Message.NumGameFeaturePlugins,
+		Message.ExecuteActionsSeconds,
+		Message.TotalSeconds,
+		*GetClientServerContextString(this));
+
+	UGameplayMessageSubsystem& MessageSystem = UGameplayMessageSubsystem::Get(this);
+	MessageSystem.BroadcastMessage(TAG_Lyra_Experience_Message_LoadTimings, Message);
+}
+
 void ULyraExperienceManagerComponent::OnActionDeactivationCompleted()
 {
 	check(IsInGameThread());
@@ -381,16 +603,47 @@ void ULyraExperienceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlay
 {
 	Super::EndPlay(EndPlayReason);
 
-	// deactivate any features this experience loaded
-	//@TODO: This should be handled FILO as well
-	for (const FString& PluginURL : GameFeaturePluginURLs)
+	if (DefinitionLoadHandle.IsValid() && DefinitionLoadHandle->IsLoadingInProgress())
+	{
+		DefinitionLoadHandle->CancelHandle();
+		DefinitionLoadHandle.Reset();
+	}
+	if (LoadState == ELyraExperienceLoadState::LoadingDefinition)
+	{
+		LoadState = ELyraExperienceLoadState::Unloaded;
+	}
+
+	const bool bKeepWarm = ULyraExperienceManager::IsWarmCacheEnabled() && (EndPlayReason == EEndPlayReason::LevelTransition) && (LoadState == ELyraExperienceLoadState::Loaded);
+	if (bKeepWarm)
+	{
+		// Leave the plugins active and the assets loaded, the next experience will deactivate whatever it doesn't share with us
+		TArray<TSharedPtr<FStreamableHandle>> HandlesToKeep = { DefinitionLoadHandle, BundleLoadHandle };
+		ULyraExperienceManager* ExperienceManagerSubsystem = GEngine->GetEngineSubsystem<ULyraExperienceManager>();
+		check(ExperienceManagerSubsystem);
+		ExperienceManagerSubsystem->StoreWarmExperienceState(GameFeaturePluginURLs, MoveTemp(HandlesToKeep));
+	}
+	else
 	{
-		if (ULyraExperienceManager::RequestToDeactivatePlugin(PluginURL))
+		// deactivate any features this experience loaded
+		//@TODO: This should be handled FILO as well
+		for (const FString& PluginURL : GameFeaturePluginURLs)
 		{
-			UGameFeaturesSubsystem::Get().DeactivateGameFeaturePlugin(PluginURL);
+			if (ULyraExperienceManager::RequestToDeactivatePlugin(PluginURL))
+			{
+				UGameFeaturesSubsystem::Get().DeactivateGameFeaturePlugin(PluginURL);
+			}
 		}
 	}
 
+	DefinitionLoadHandle.Reset();
+	BundleLoadHandle.Reset();
+
+	for (const TSharedPtr<FStreamableHandle>& Handle : WarmCacheHandles)
+	{
+		Handle->ReleaseHandle();
+	}
+	WarmCacheHandles.Reset();
+
 	//@TODO: Ensure proper handling of a partially-loaded state too
 	if (LoadState == ELyraExperienceLoadState::Loaded)
 	{
@@ -448,6 +701,7 @@ bool ULyraExperienceManagerComponent::ShouldShowLoadingScreen(FString& OutReason
 {
 	if (LoadState != ELyraExperienceLoadState::Loaded)
 	{
+		// Loading screen widgets read the progress through GetExperienceLoadProgressForWorld
 		OutReason = TEXT("Experience still loading");
 		return true;
 	}
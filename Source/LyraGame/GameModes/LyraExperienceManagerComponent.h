@@ -4,6 +4,7 @@
 
 #include "Components/GameStateComponent.h"
 #include "LoadingProcessInterface.h"
+#include "Engine/StreamableManager.h"
 
 #include "LyraExperienceManagerComponent.generated.h"
 
@@ -16,6 +17,7 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnLyraExperienceLoaded, const ULyraExperien
 enum class ELyraExperienceLoadState
 {
 	Unloaded,
+	LoadingDefinition,
 	Loading,
 	LoadingGameFeatures,
 	LoadingChaosTestingDelay,
@@ -24,6 +26,39 @@ enum class ELyraExperienceLoadState
 	Deactivating
 };
 
+// Message broadcast once an experience has finished loading, with the time spent in each phase (in seconds)
+USTRUCT(BlueprintType)
+struct FLyraExperienceLoadTimingsMessage
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category=Experience)
+	FPrimaryAssetId ExperienceId;
+
+	// Time spent async loading the experience definition (zero for clients, which receive it via replication)
+	UPROPERTY(BlueprintReadOnly, Category=Experience)
+	float DefinitionLoadSeconds = 0.0f;
+
+	// Time from the start of the experience load until its asset bundles finished loading
+	UPROPERTY(BlueprintReadOnly, Category=Experience)
+	float BundleLoadSeconds = 0.0f;
+
+	// Time from the start of the experience load until all game feature plugins were loaded and activated
+	UPROPERTY(BlueprintReadOnly, Category=Experience)
+	float GameFeatureActivationSeconds = 0.0f;
+
+	// Time spent running the experience actions
+	UPROPERTY(BlueprintReadOnly, Category=Experience)
+	float ExecuteActionsSeconds = 0.0f;
+
+	// Time from the first request until the experience was fully loaded
+	UPROPERTY(BlueprintReadOnly, Category=Experience)
+	float TotalSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category=Experience)
+	int32 NumGameFeaturePlugins = 0;
+};
+
 UCLASS()
 class LYRAGAME_API ULyraExperienceManagerComponent final : public UGameStateComponent, public ILoadingProcessInterface
 {
@@ -64,18 +99,34 @@ public:
 	// Returns true if the experience is fully loaded
 	bool IsExperienceLoaded() const;
 
+	// Returns an estimate of how far along the experience load is, in the range [0, 1]
+	// Streamable handle progress is expensive to query, so the estimate is refreshed at most a few times per second
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Lyra|Experience")
+	float GetExperienceLoadProgress() const;
+
+	// Returns the experience load progress of the world's game state for loading screen widgets, 0 if there is no experience manager yet
+	UFUNCTION(BlueprintPure, Category = "Lyra|Experience", meta = (WorldContext = "WorldContextObject"))
+	static float GetExperienceLoadProgressForWorld(const UObject* WorldContextObject);
+
 private:
 	UFUNCTION()
 	void OnRep_CurrentExperience();
 
+	void OnExperienceDefinitionLoaded(FPrimaryAssetId ExperienceId, FSoftObjectPath AssetPath);
 	void StartExperienceLoad();
+	void CollectGameFeaturePluginURLs();
+	void StartGameFeaturePluginLoads();
 	void OnExperienceLoadComplete();
 	void OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result);
+	void TryCompleteExperienceLoad();
 	void OnExperienceFullLoadCompleted();
+	void BroadcastLoadTimings();
 
 	void OnActionDeactivationCompleted();
 	void OnAllActionsDeactivated();
 
+	float ComputeExperienceLoadProgress() const;
+
 private:
 	UPROPERTY(ReplicatedUsing=OnRep_CurrentExperience)
 	TObjectPtr<const ULyraExperienceDefinition> CurrentExperience;
@@ -85,9 +136,33 @@ private:
 	int32 NumGameFeaturePluginsLoading = 0;
 	TArray<FString> GameFeaturePluginURLs;
 
+	bool bGameFeaturePluginLoadsStarted = false;
+	bool bExperienceBundlesLoaded = false;
+
+	TSharedPtr<FStreamableHandle> DefinitionLoadHandle;
+	TSharedPtr<FStreamableHandle> BundleLoadHandle;
+
+	// Plugins left active by the previous experience (see ULyraExperienceManager::IsWarmCacheEnabled), these skip load and activation
+	TSet<FString> WarmGameFeaturePluginURLs;
+
+	// Handles from the previous experience, kept until our own bundles finish loading so shared assets stay resident
+	TArray<TSharedPtr<FStreamableHandle>> WarmCacheHandles;
+
+	// Timestamps (FPlatformTime::Seconds) for each load phase, used to build FLyraExperienceLoadTimingsMessage
+	double LoadRequestTime = 0.0;
+	double LoadStartTime = 0.0;
+	double BundlesLoadedTime = 0.0;
+	double GameFeaturesLoadedTime = 0.0;
+	double ExecuteActionsStartTime = 0.0;
+
 	int32 NumObservedPausers = 0;
 	int32 NumExpectedPausers = 0;
 
+	// Last value returned by GetExperienceLoadProgress, with the time and load state it was computed for
+	mutable float CachedLoadProgress = 0.0f;
+	mutable double CachedLoadProgressTime = -1.0;
+	mutable ELyraExperienceLoadState CachedLoadProgressState = ELyraExperienceLoadState::Unloaded;
+
 	/**
 	 * Delegate called when the experience has finished loading just before others
 	 * (e.g., subsystems that set up for regular gameplay)
@@ -23,10 +23,15 @@
 #include "Kismet/GameplayStatics.h"
 #include "Development/LyraDeveloperSettings.h"
 #include "Player/LyraPlayerSpawningManagerComponent.h"
+#include "Replays/LyraReplaySubsystem.h"
 #include "CommonUserSubsystem.h"
 #include "CommonSessionSubsystem.h"
 #include "TimerManager.h"
 #include "GameMapsSettings.h"
+#if WITH_RPC_REGISTRY
+#include "Tests/LyraGameplayRpcRegistrationComponent.h"
+#include "HttpServerModule.h"
+#endif
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraGameMode)
 
@@ -81,6 +86,19 @@ void ALyraGameMode::InitGame(const FString& MapName, const FString& Options, FSt
 {
 	Super::InitGame(MapName, Options, ErrorMessage);
 
+#if WITH_RPC_REGISTRY
+	// Dedicated servers never get a local player controller, so register the always-on RPCs (including soak testing) here
+	int32 RpcPort = 0;
+	if (IsRunningDedicatedServer() && FParse::Value(FCommandLine::Get(), TEXT("rpcport="), RpcPort))
+	{
+		FHttpServerModule::Get().StartAllListeners();
+		if (ULyraGameplayRpcRegistrationComponent* ObjectInstance = ULyraGameplayRpcRegistrationComponent::GetInstance())
+		{
+			ObjectInstance->RegisterAlwaysOnHttpCallbacks();
+		}
+	}
+#endif
+
 	// Wait for the next frame to give time to initialize startup settings
 	GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::HandleMatchAssignmentIfNotExpectingOne);
 }
@@ -318,6 +336,15 @@ void ALyraGameMode::OnExperienceLoaded(const ULyraExperienceDefinition* CurrentE
 			}
 		}
 	}
+
+	// Record the whole match on dedicated servers, e.g. for reviewing cheating reports
+	if ((GetNetMode() == NM_DedicatedServer) && ULyraReplaySubsystem::ShouldRecordServerReplays())
+	{
+		if (ULyraReplaySubsystem* ReplaySubsystem = GetGameInstance()->GetSubsystem<ULyraReplaySubsystem>())
+		{
+			ReplaySubsystem->RecordServerReplay();
+		}
+	}
 }
 
 bool ALyraGameMode::IsExperienceLoaded() const
@@ -38,3 +38,32 @@ void ULyraInputComponent::RemoveBinds(TArray<uint32>& BindHandles)
 	}
 	BindHandles.Reset();
 }
+
+void ULyraInputComponent::RemoveAbilityActionBindings(const ULyraInputConfig* InputConfig)
+{
+	check(InputConfig);
+
+	int32* ConfigRefCount = AddedAbilityInputConfigs.Find(InputConfig);
+	if (!ConfigRefCount || --(*ConfigRefCount) > 0)
+	{
+		return;
+	}
+	AddedAbilityInputConfigs.Remove(InputConfig);
+
+	for (const FLyraInputAction& Action : InputConfig->AbilityInputActions)
+	{
+		if (Action.InputAction && Action.InputTag.IsValid())
+		{
+			const FAbilityActionBindingKey Key = { Action.InputAction, Action.InputTag };
+			FAbilityActionBinding* Binding = AbilityActionBindings.Find(Key);
+			if (Binding && --Binding->RefCount <= 0)
+			{
+				for (uint32 Handle : Binding->BindHandles)
+				{
+					RemoveBindingByHandle(Handle);
+				}
+				AbilityActionBindings.Remove(Key);
+			}
+		}
+	}
+}
@@ -4,6 +4,7 @@
 
 #include "EnhancedInputComponent.h"
 #include "LyraInputConfig.h"
+#include "UObject/ObjectKey.h"
 
 #include "LyraInputComponent.generated.h"
 
@@ -36,6 +37,41 @@ public:
 	void BindAbilityActions(const ULyraInputConfig* InputConfig, UserClass* Object, PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, TArray<uint32>& BindHandles);
 
 	void RemoveBinds(TArray<uint32>& BindHandles);
+
+	/**
+	 * Binds the ability actions of an input config, only adding the bindings that aren't already there.
+	 * Bindings are reference counted per input action and tag, so configs that share actions (e.g. when swapping between them) keep the shared bindings.
+	 */
+	template<class UserClass, typename PressedFuncType, typename ReleasedFuncType>
+	void AddAbilityActionBindings(const ULyraInputConfig* InputConfig, UserClass* Object, PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc);
+
+	/** Releases the ability action bindings added by AddAbilityActionBindings, removing the ones no other added config uses */
+	void RemoveAbilityActionBindings(const ULyraInputConfig* InputConfig);
+
+	/** Returns true if the ability actions of this input config have been added with AddAbilityActionBindings */
+	bool HasAbilityActionBindings(const ULyraInputConfig* InputConfig) const { return AddedAbilityInputConfigs.Contains(InputConfig); }
+
+private:
+	struct FAbilityActionBindingKey
+	{
+		const UInputAction* InputAction = nullptr;
+		FGameplayTag InputTag;
+
+		bool operator==(const FAbilityActionBindingKey& Other) const { return (InputAction == Other.InputAction) && (InputTag == Other.InputTag); }
+		friend uint32 GetTypeHash(const FAbilityActionBindingKey& Key) { return HashCombine(GetTypeHash(Key.InputAction), GetTypeHash(Key.InputTag)); }
+	};
+
+	struct FAbilityActionBinding
+	{
+		TArray<uint32, TInlineAllocator<2>> BindHandles;
+		int32 RefCount = 0;
+	};
+
+	// Ability action bindings shared by all the added input configs
+	TMap<FAbilityActionBindingKey, FAbilityActionBinding> AbilityActionBindings;
+
+	// Number of times each input config has been added
+	TMap<TObjectKey<ULyraInputConfig>, int32> AddedAbilityInputConfigs;
 };
 
 
@@ -70,3 +106,37 @@ void ULyraInputComponent::BindAbilityActions(const ULyraInputConfig* InputConfig
 		}
 	}
 }
+
+template<class UserClass, typename PressedFuncType, typename ReleasedFuncType>
+void ULyraInputComponent::AddAbilityActionBindings(const ULyraInputConfig* InputConfig, UserClass* Object, PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc)
+{
+	check(InputConfig);
+
+	int32& ConfigRefCount = AddedAbilityInputConfigs.FindOrAdd(InputConfig);
+	if (ConfigRefCount++ > 0)
+	{
+		return;
+	}
+
+	for (const FLyraInputAction& Action : InputConfig->AbilityInputActions)
+	{
+		if (Action.InputAction && Action.InputTag.IsValid())
+		{
+			FAbilityActionBinding& Binding = AbilityActionBindings.FindOrAdd({ Action.InputAction, Action.InputTag });
+			if (Binding.RefCount++ > 0)
+			{
+				continue;
+			}
+
+			if (PressedFunc)
+			{
+				Binding.BindHandles.Add(BindAction(Action.InputAction, ETriggerEvent::Triggered, Object, PressedFunc, Action.InputTag).GetHandle());
+			}
+
+			if (ReleasedFunc)
+			{
+				Binding.BindHandles.Add(BindAction(Action.InputAction, ETriggerEvent::Completed, Object, ReleasedFunc, Action.InputTag).GetHandle());
+			}
+		}
+	}
+}
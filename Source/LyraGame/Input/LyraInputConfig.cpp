@@ -6,19 +6,74 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraInputConfig)
 
+namespace LyraInputConfig
+{
+	static const UInputAction* FindInputActionForTag(const TArray<FLyraInputAction>& Actions, const TMap<FGameplayTag, TObjectPtr<const UInputAction>>& ActionMap, const FGameplayTag& InputTag)
+	{
+		if (const TObjectPtr<const UInputAction>* InputAction = ActionMap.Find(InputTag))
+		{
+			return *InputAction;
+		}
+
+		// Configs created at runtime (e.g. with NewObject) are never loaded, so their map is empty and the list is searched instead
+		if (ActionMap.IsEmpty())
+		{
+			for (const FLyraInputAction& Action : Actions)
+			{
+				if (Action.InputAction && (Action.InputTag == InputTag))
+				{
+					return Action.InputAction;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+}
 
 ULyraInputConfig::ULyraInputConfig(const FObjectInitializer& ObjectInitializer)
 {
 }
 
-const UInputAction* ULyraInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+void ULyraInputConfig::PostLoad()
 {
-	for (const FLyraInputAction& Action : NativeInputActions)
+	Super::PostLoad();
+
+	BuildInputActionMaps();
+}
+
+#if WITH_EDITOR
+void ULyraInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildInputActionMaps();
+}
+#endif
+
+void ULyraInputConfig::BuildInputActionMaps()
+{
+	auto BuildMap = [](const TArray<FLyraInputAction>& Actions, TMap<FGameplayTag, TObjectPtr<const UInputAction>>& OutMap)
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
+		OutMap.Reset();
+		for (const FLyraInputAction& Action : Actions)
 		{
-			return Action.InputAction;
+			if (Action.InputAction && !OutMap.Contains(Action.InputTag))
+			{
+				OutMap.Add(Action.InputTag, Action.InputAction);
+			}
 		}
+	};
+
+	BuildMap(NativeInputActions, NativeInputActionMap);
+	BuildMap(AbilityInputActions, AbilityInputActionMap);
+}
+
+const UInputAction* ULyraInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+{
+	if (const UInputAction* InputAction = LyraInputConfig::FindInputActionForTag(NativeInputActions, NativeInputActionMap, InputTag))
+	{
+		return InputAction;
 	}
 
 	if (bLogNotFound)
@@ -31,12 +86,9 @@ const UInputAction* ULyraInputConfig::FindNativeInputActionForTag(const FGamepla
 
 const UInputAction* ULyraInputConfig::FindAbilityInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
 {
-	for (const FLyraInputAction& Action : AbilityInputActions)
+	if (const UInputAction* InputAction = LyraInputConfig::FindInputActionForTag(AbilityInputActions, AbilityInputActionMap, InputTag))
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
-		{
-			return Action.InputAction;
-		}
+		return InputAction;
 	}
 
 	if (bLogNotFound)
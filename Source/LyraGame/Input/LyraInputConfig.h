@@ -44,6 +44,13 @@ public:
 
 	ULyraInputConfig(const FObjectInitializer& ObjectInitializer);
 
+	//~UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
 	UFUNCTION(BlueprintCallable, Category = "Lyra|Pawn")
 	const UInputAction* FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = true) const;
 
@@ -58,4 +65,15 @@ public:
 	// List of input actions used by the owner.  These input actions are mapped to a gameplay tag and are automatically bound to abilities with matching input tags.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Meta = (TitleProperty = "InputAction"))
 	TArray<FLyraInputAction> AbilityInputActions;
+
+private:
+	// Rebuilds the tag lookups from the action lists. The first valid action for a tag wins, matching the order of the lists.
+	void BuildInputActionMaps();
+
+	// Tag lookups built from NativeInputActions and AbilityInputActions when the asset is loaded, lookups fall back to the lists while they are empty
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, TObjectPtr<const UInputAction>> NativeInputActionMap;
+
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, TObjectPtr<const UInputAction>> AbilityInputActionMap;
 };
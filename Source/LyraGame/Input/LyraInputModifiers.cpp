@@ -29,7 +29,19 @@ namespace LyraInputModifiersHelpers
 		}
 		return nullptr;
 	}
-	
+
+	/** Returns the input settings snapshot of the player owning an Enhanced Player Input pointer */
+	static const FLyraInputSettingsSnapshot* GetInputSettings(const UEnhancedPlayerInput* PlayerInput)
+	{
+		if (ULyraLocalPlayer* LocalPlayer = GetLocalPlayer(PlayerInput))
+		{
+			if (const ULyraSettingsShared* SharedSettings = LocalPlayer->GetSharedSettings())
+			{
+				return &SharedSettings->GetInputSettingsSnapshot();
+			}
+		}
+		return nullptr;
+	}
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -39,22 +51,14 @@ FInputActionValue ULyraSettingBasedScalar::ModifyRaw_Implementation(const UEnhan
 {
 	if (ensureMsgf(CurrentValue.GetValueType() != EInputActionValueType::Boolean, TEXT("Setting Based Scalar modifier doesn't support boolean values.")))
 	{
-		if (ULyraLocalPlayer* LocalPlayer = LyraInputModifiersHelpers::GetLocalPlayer(PlayerInput))
+		if (const FLyraInputSettingsSnapshot* InputSettings = LyraInputModifiersHelpers::GetInputSettings(PlayerInput))
 		{
-			const UClass* SettingsClass = ULyraSettingsShared::StaticClass();
-			ULyraSettingsShared* SharedSettings = LocalPlayer->GetSharedSettings();
-			
-			const bool bHasCachedProperty = PropertyCache.Num() == 3;
-			
-			const FProperty* XAxisValue = bHasCachedProperty ? PropertyCache[0] : SettingsClass->FindPropertyByName(XAxisScalarSettingName);
-			const FProperty* YAxisValue = bHasCachedProperty ? PropertyCache[1] : SettingsClass->FindPropertyByName(YAxisScalarSettingName);
-			const FProperty* ZAxisValue = bHasCachedProperty ? PropertyCache[2] : SettingsClass->FindPropertyByName(ZAxisScalarSettingName);
-
-			if (PropertyCache.IsEmpty())
+			if (!bHasCachedScalarSettingIndices)
 			{
-				PropertyCache.Emplace(XAxisValue);
-				PropertyCache.Emplace(YAxisValue);
-				PropertyCache.Emplace(ZAxisValue);
+				ScalarSettingIndexCache[0] = FLyraInputSettingsSnapshot::FindScalarSettingIndex(XAxisScalarSettingName);
+				ScalarSettingIndexCache[1] = FLyraInputSettingsSnapshot::FindScalarSettingIndex(YAxisScalarSettingName);
+				ScalarSettingIndexCache[2] = FLyraInputSettingsSnapshot::FindScalarSettingIndex(ZAxisScalarSettingName);
+				bHasCachedScalarSettingIndices = true;
 			}
 
 			FVector ScalarToUse = FVector(1.0, 1.0, 1.0);
@@ -62,13 +66,13 @@ FInputActionValue ULyraSettingBasedScalar::ModifyRaw_Implementation(const UEnhan
 			switch (CurrentValue.GetValueType())
 			{
 			case EInputActionValueType::Axis3D:
-				ScalarToUse.Z = ZAxisValue ? *ZAxisValue->ContainerPtrToValuePtr<double>(SharedSettings) : 1.0;
+				ScalarToUse.Z = InputSettings->GetScalarSetting(ScalarSettingIndexCache[2], 1.0);
 				//[[fallthrough]];
 			case EInputActionValueType::Axis2D:
-				ScalarToUse.Y = YAxisValue ? *YAxisValue->ContainerPtrToValuePtr<double>(SharedSettings) : 1.0;
+				ScalarToUse.Y = InputSettings->GetScalarSetting(ScalarSettingIndexCache[1], 1.0);
 				//[[fallthrough]];
 			case EInputActionValueType::Axis1D:
-				ScalarToUse.X = XAxisValue ? *XAxisValue->ContainerPtrToValuePtr<double>(SharedSettings) : 1.0;
+				ScalarToUse.X = InputSettings->GetScalarSetting(ScalarSettingIndexCache[0], 1.0);
 				break;
 			}
 
@@ -89,19 +93,16 @@ FInputActionValue ULyraSettingBasedScalar::ModifyRaw_Implementation(const UEnhan
 FInputActionValue ULyraInputModifierDeadZone::ModifyRaw_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue CurrentValue, float DeltaTime)
 {
 	EInputActionValueType ValueType = CurrentValue.GetValueType();
-	ULyraLocalPlayer* LocalPlayer = LyraInputModifiersHelpers::GetLocalPlayer(PlayerInput);
-	if (ValueType == EInputActionValueType::Boolean || !LocalPlayer)
+	const FLyraInputSettingsSnapshot* Settings = LyraInputModifiersHelpers::GetInputSettings(PlayerInput);
+	if (ValueType == EInputActionValueType::Boolean || !Settings)
 	{
 		return CurrentValue;
 	}
-	
-	ULyraSettingsShared* Settings = LocalPlayer->GetSharedSettings();
-	ensure(Settings);
 
 	float LowerThreshold =
 		(DeadzoneStick == EDeadzoneStick::MoveStick) ? 
-		Settings->GetGamepadMoveStickDeadZone() :
-		Settings->GetGamepadLookStickDeadZone();
+		Settings->GamepadMoveStickDeadZone :
+		Settings->GamepadLookStickDeadZone;
 	
 	LowerThreshold = FMath::Clamp(LowerThreshold, 0.0f, 1.0f);
 	
@@ -154,16 +155,13 @@ FLinearColor ULyraInputModifierDeadZone::GetVisualizationColor_Implementation(FI
 FInputActionValue ULyraInputModifierGamepadSensitivity::ModifyRaw_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue CurrentValue, float DeltaTime)
 {
 	// You can't scale a boolean action type
-	ULyraLocalPlayer* LocalPlayer = LyraInputModifiersHelpers::GetLocalPlayer(PlayerInput);
-	if (CurrentValue.GetValueType() == EInputActionValueType::Boolean || !LocalPlayer || !SensitivityLevelTable)
+	const FLyraInputSettingsSnapshot* Settings = LyraInputModifiersHelpers::GetInputSettings(PlayerInput);
+	if (CurrentValue.GetValueType() == EInputActionValueType::Boolean || !Settings || !SensitivityLevelTable)
 	{
 		return CurrentValue;
 	}
-	
-	ULyraSettingsShared* Settings = LocalPlayer->GetSharedSettings();
-	ensure(Settings);
 
-	const ELyraGamepadSensitivity Sensitivity = (TargetingType == ELyraTargetingType::Normal) ? Settings->GetGamepadLookSensitivityPreset() : Settings->GetGamepadTargetingSensitivityPreset();
+	const ELyraGamepadSensitivity Sensitivity = (TargetingType == ELyraTargetingType::Normal) ? Settings->GamepadLookSensitivityPreset : Settings->GamepadTargetingSensitivityPreset;
 
 	const float Scalar = SensitivityLevelTable->SensitivtyEnumToFloat(Sensitivity);
 
@@ -175,23 +173,20 @@ FInputActionValue ULyraInputModifierGamepadSensitivity::ModifyRaw_Implementation
 
 FInputActionValue ULyraInputModifierAimInversion::ModifyRaw_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue CurrentValue, float DeltaTime)
 {
-	ULyraLocalPlayer* LocalPlayer = LyraInputModifiersHelpers::GetLocalPlayer(PlayerInput);
-	if (!LocalPlayer)
+	const FLyraInputSettingsSnapshot* Settings = LyraInputModifiersHelpers::GetInputSettings(PlayerInput);
+	if (!Settings)
 	{
 		return CurrentValue;
 	}
-	
-	ULyraSettingsShared* Settings = LocalPlayer->GetSharedSettings();
-	ensure(Settings);
 
 	FVector NewValue = CurrentValue.Get<FVector>();
 	
-	if (Settings->GetInvertVerticalAxis())
+	if (Settings->bInvertVerticalAxis)
 	{
 		NewValue.Y *= -1.0f;
 	}
 	
-	if (Settings->GetInvertHorizontalAxis())
+	if (Settings->bInvertHorizontalAxis)
 	{
 		NewValue.X *= -1.0f;
 	}
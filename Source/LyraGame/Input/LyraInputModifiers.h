@@ -4,12 +4,10 @@
 
 #include "InputModifiers.h"
 
-#include "UObject/UnrealType.h"
 #include "LyraInputModifiers.generated.h"
 
 struct FInputActionValue;
 
-class FProperty;
 class UEnhancedPlayerInput;
 class ULyraAimSensitivityData;
 class UObject;
@@ -47,8 +45,9 @@ public:
 protected:
 	virtual FInputActionValue ModifyRaw_Implementation(const UEnhancedPlayerInput* PlayerInput, FInputActionValue CurrentValue, float DeltaTime) override;
 
-	/** FProperty Cache that will be populated with any found FProperty's on the settings class so that we don't need to look them up each frame */
-	TArray<const FProperty*> PropertyCache;
+	/** Index of each axis setting in FLyraInputSettingsSnapshot::ScalarSettings, resolved on first use so we don't need to look them up each frame */
+	int32 ScalarSettingIndexCache[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	bool bHasCachedScalarSettingIndices = false;
 };
 
 /** Represents which stick that this deadzone is for, either the move or the look stick */
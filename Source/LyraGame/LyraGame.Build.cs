@@ -68,12 +68,15 @@ public class LyraGame : ModuleRules
 				"GameplayMessageRuntime",
 				"AudioMixer",
 				"NetworkReplayStreaming",
+				"LocalFileNetworkReplayStreaming",
 				"UIExtension",
 				"ClientPilot",
 				"AudioModulation",
 				"EngineSettings",
 				"DTLSHandlerComponent",
 				"Json",
+				"NavigationSystem",
+				"Sockets",
 			}
 		);
 
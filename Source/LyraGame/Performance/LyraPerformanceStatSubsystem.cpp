@@ -24,6 +24,19 @@ void FLyraPerformanceStatCache::StartCharting()
 void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
 {
 	CachedData = FrameData;
+
+	// Leave out time spent waiting on vsync or the frame rate limit so the history reflects how much headroom we have
+	const float BusyFrameTime = (float)FMath::Max(FrameData.TrueDeltaSeconds - FrameData.IdleSeconds, 0.0);
+	if (RecentFrameTimes.Num() < MaxRecentFrameTimes)
+	{
+		RecentFrameTimes.Add(BusyFrameTime);
+	}
+	else
+	{
+		RecentFrameTimes[NextRecentFrameTimeIndex] = BusyFrameTime;
+	}
+	NextRecentFrameTimeIndex = (NextRecentFrameTimeIndex + 1) % MaxRecentFrameTimes;
+
 	CachedServerFPS = 0.0f;
 	CachedPingMS = 0.0f;
 	CachedPacketLossIncomingPercent = 0.0f;
@@ -108,6 +121,26 @@ double FLyraPerformanceStatCache::GetCachedStat(ELyraDisplayablePerformanceStat
 	return 0.0f;
 }
 
+double FLyraPerformanceStatCache::GetRecentFrameTimePercentile(float Percentile) const
+{
+	if (RecentFrameTimes.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	TArray<float, TInlineAllocator<MaxRecentFrameTimes>> SortedFrameTimes(RecentFrameTimes);
+	SortedFrameTimes.Sort();
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt32(FMath::Clamp(Percentile, 0.0f, 1.0f) * SortedFrameTimes.Num()) - 1, 0, SortedFrameTimes.Num() - 1);
+	return SortedFrameTimes[Index];
+}
+
+void FLyraPerformanceStatCache::ResetRecentFrameTimes()
+{
+	RecentFrameTimes.Reset();
+	NextRecentFrameTimeIndex = 0;
+}
+
 //////////////////////////////////////////////////////////////////////
 // ULyraPerformanceStatSubsystem
 
@@ -128,3 +161,18 @@ double ULyraPerformanceStatSubsystem::GetCachedStat(ELyraDisplayablePerformanceS
 	return Tracker->GetCachedStat(Stat);
 }
 
+
+double ULyraPerformanceStatSubsystem::GetRecentFrameTimePercentile(float Percentile) const
+{
+	return Tracker->GetRecentFrameTimePercentile(Percentile);
+}
+
+int32 ULyraPerformanceStatSubsystem::GetNumRecentFrameTimes() const
+{
+	return Tracker->GetNumRecentFrameTimes();
+}
+
+void ULyraPerformanceStatSubsystem::ResetRecentFrameTimes()
+{
+	Tracker->ResetRecentFrameTimes();
+}
@@ -33,10 +33,27 @@ public:
 
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	// Returns the requested percentile (0..1) of the recent frame times in seconds (excluding time spent idle waiting for
+	// vsync or the frame rate limit), or 0 if no frames have been recorded
+	double GetRecentFrameTimePercentile(float Percentile) const;
+
+	// Returns how many frames are currently in the rolling frame time history
+	int32 GetNumRecentFrameTimes() const { return RecentFrameTimes.Num(); }
+
+	// Discards the rolling frame time history (e.g., after a change that invalidates previous measurements)
+	void ResetRecentFrameTimes();
+
+	// Number of frames kept in the rolling frame time history
+	static constexpr int32 MaxRecentFrameTimes = 240;
+
 protected:
 	IPerformanceDataConsumer::FFrameData CachedData;
 	ULyraPerformanceStatSubsystem* MySubsystem;
 
+	// Ring buffer of the most recent frame times (in seconds, excluding idle time)
+	TArray<float> RecentFrameTimes;
+	int32 NextRecentFrameTimeIndex = 0;
+
 	float CachedServerFPS = 0.0f;
 	float CachedPingMS = 0.0f;
 	float CachedPacketLossIncomingPercent = 0.0f;
@@ -59,6 +76,16 @@ public:
 	UFUNCTION(BlueprintCallable)
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	// Returns the requested percentile (0..1) of the recent frame times in seconds
+	UFUNCTION(BlueprintCallable)
+	double GetRecentFrameTimePercentile(float Percentile) const;
+
+	// Returns how many frames are currently in the rolling frame time history
+	int32 GetNumRecentFrameTimes() const;
+
+	// Discards the rolling frame time history
+	void ResetRecentFrameTimes();
+
 	//~USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
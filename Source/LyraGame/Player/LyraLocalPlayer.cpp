@@ -3,6 +3,7 @@
 #include "Player/LyraLocalPlayer.h"
 
 #include "AudioMixerBlueprintLibrary.h"
+#include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Settings/LyraSettingsLocal.h"
@@ -27,6 +28,31 @@ void ULyraLocalPlayer::PostInitProperties()
 	}
 }
 
+void ULyraLocalPlayer::UpdateViewSnapshot()
+{
+	ViewSnapshot.FrameNumber = GFrameCounter;
+	ViewSnapshot.bIsValid = false;
+
+	if (!PlayerController || !ViewportClient || !ViewportClient->Viewport)
+	{
+		return;
+	}
+
+	if (!GetProjectionData(ViewportClient->Viewport, /*out*/ ViewSnapshot.ProjectionData))
+	{
+		return;
+	}
+
+	PlayerController->GetPlayerViewPoint(ViewSnapshot.ViewLocation, ViewSnapshot.ViewRotation);
+
+	ViewSnapshot.ViewProjectionMatrix = ViewSnapshot.ProjectionData.ComputeViewProjectionMatrix();
+	ViewSnapshot.InvViewProjectionMatrix = ViewSnapshot.ViewProjectionMatrix.Inverse();
+	ViewSnapshot.ViewRect = ViewSnapshot.ProjectionData.GetConstrainedViewRect();
+	GetViewFrustumBounds(ViewSnapshot.ViewFrustum, ViewSnapshot.ViewProjectionMatrix, /*bUseNearPlane=*/ false);
+
+	ViewSnapshot.bIsValid = true;
+}
+
 void ULyraLocalPlayer::SwitchController(class APlayerController* PC)
 {
 	Super::SwitchController(PC);
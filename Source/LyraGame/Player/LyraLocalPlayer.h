@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CommonLocalPlayer.h"
+#include "ConvexVolume.h"
+#include "SceneView.h"
 #include "Teams/LyraTeamAgentInterface.h"
 
 #include "LyraLocalPlayer.generated.h"
@@ -18,6 +20,42 @@ class UWorld;
 struct FFrame;
 struct FSwapAudioOutputResult;
 
+/**
+ * The view of a local player as of the last camera update.
+ * Taken once per frame so the HUD and input code can project into and cull against the view without rebuilding the matrices themselves.
+ */
+struct FLyraLocalPlayerViewSnapshot
+{
+	/** Frame the snapshot was taken on, see GFrameCounter */
+	uint64 FrameNumber = 0;
+
+	/** False until the first camera update with a valid viewport */
+	bool bIsValid = false;
+
+	FSceneViewProjectionData ProjectionData;
+
+	FMatrix ViewProjectionMatrix = FMatrix::Identity;
+	FMatrix InvViewProjectionMatrix = FMatrix::Identity;
+
+	FIntRect ViewRect = FIntRect(0, 0, 0, 0);
+
+	/** Player view point, i.e. the camera location and rotation */
+	FVector ViewLocation = FVector::ZeroVector;
+	FRotator ViewRotation = FRotator::ZeroRotator;
+
+	/** Frustum planes of the view, without the near plane */
+	FConvexVolume ViewFrustum;
+
+	/**
+	 * Returns true if the snapshot is valid and was taken by the latest camera update, i.e. this frame or the one before for code running ahead of the camera.
+	 * Snapshots are only taken by ALyraPlayerController, so a local player driven by any other controller never has a current one.
+	 */
+	bool IsCurrent() const
+	{
+		return bIsValid && ((GFrameCounter - FrameNumber) <= 1);
+	}
+};
+
 /**
  * ULyraLocalPlayer
  */
@@ -60,6 +98,12 @@ public:
 	/** Starts an async request to load the shared settings, this will call OnSharedSettingsLoaded after loading or creating new ones */
 	void LoadSharedSettingsFromDisk(bool bForceLoad = false);
 
+	/** Gets the view as of the last camera update, check IsCurrent before using it */
+	const FLyraLocalPlayerViewSnapshot& GetViewSnapshot() const { return ViewSnapshot; }
+
+	/** Takes a new view snapshot, called by the player controller after its camera has been updated */
+	void UpdateViewSnapshot();
+
 protected:
 	void OnSharedSettingsLoaded(ULyraSettingsShared* LoadedOrCreatedSettings);
 
@@ -87,4 +131,6 @@ private:
 
 	UPROPERTY()
 	TWeakObjectPtr<APlayerController> LastBoundPC;
+
+	FLyraLocalPlayerViewSnapshot ViewSnapshot;
 };
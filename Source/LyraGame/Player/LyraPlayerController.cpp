@@ -7,6 +7,9 @@
 #include "LyraCheatManager.h"
 #include "LyraPlayerState.h"
 #include "Camera/LyraPlayerCameraManager.h"
+#include "Cosmetics/LyraPawnComponent_CharacterParts.h"
+#include "Equipment/LyraEquipmentInstance.h"
+#include "Equipment/LyraEquipmentManagerComponent.h"
 #include "UI/LyraHUD.h"
 #include "AbilitySystem/LyraAbilitySystemComponent.h"
 #include "EngineUtils.h"
@@ -462,51 +465,120 @@ void ALyraPlayerController::UpdateHiddenComponents(const FVector& ViewLocation,
 		AActor* const ViewTargetPawn = PlayerCameraManager ? Cast<AActor>(PlayerCameraManager->GetViewTarget()) : nullptr;
 		if (ViewTargetPawn)
 		{
-			// internal helper func to hide all the components
-			auto AddToHiddenComponents = [&OutHiddenComponents](const TInlineComponentArray<UPrimitiveComponent*>& InComponents)
+			//TODO Solve with an interface.  Gather hidden components or something.
+			//TODO Hiding isn't awesome, sometimes you want the effect of a fade out over a proximity, needs to bubble up to designers.
+
+			// The camera can stay inside the pawn for many frames in a row, so only gather the components again when they changed
+			if (!HiddenViewTargetCache.IsValidFor(ViewTargetPawn))
 			{
-				// add every component and all attached children
-				for (UPrimitiveComponent* Comp : InComponents)
+				RebuildHiddenViewTargetCache(ViewTargetPawn);
+			}
+
+			for (const TWeakObjectPtr<UPrimitiveComponent>& HiddenComponent : HiddenViewTargetCache.HiddenComponents)
+			{
+				if (const UPrimitiveComponent* Comp = HiddenComponent.Get())
 				{
-					if (Comp->IsRegistered())
+					OutHiddenComponents.Add(Comp->GetPrimitiveSceneId());
+				}
+			}
+		}
+
+		// we consumed it, reset for next frame
+		bHideViewTargetPawnNextFrame = false;
+	}
+}
+
+void ALyraPlayerController::UpdateCameraManager(float DeltaSeconds)
+{
+	Super::UpdateCameraManager(DeltaSeconds);
+
+	// Take the view once for everything that projects into it this frame (HUD indicators, aim assist, etc.)
+	if (ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(GetLocalPlayer()))
+	{
+		LyraLocalPlayer->UpdateViewSnapshot();
+	}
+}
+
+void ALyraPlayerController::RebuildHiddenViewTargetCache(AActor* ViewTargetPawn)
+{
+	AActor* PreviousViewTarget = HiddenViewTargetCache.ViewTarget.Get();
+	if (PreviousViewTarget != ViewTargetPawn)
+	{
+		if (ULyraPawnComponent_CharacterParts* PreviousParts = PreviousViewTarget ? PreviousViewTarget->FindComponentByClass<ULyraPawnComponent_CharacterParts>() : nullptr)
+		{
+			PreviousParts->OnCharacterPartsChanged.RemoveDynamic(this, &ThisClass::OnHiddenViewTargetCharacterPartsChanged);
+		}
+
+		if (ULyraPawnComponent_CharacterParts* NewParts = ViewTargetPawn->FindComponentByClass<ULyraPawnComponent_CharacterParts>())
+		{
+			NewParts->OnCharacterPartsChanged.AddUniqueDynamic(this, &ThisClass::OnHiddenViewTargetCharacterPartsChanged);
+		}
+	}
+
+	FLyraHiddenViewTargetCache& Cache = HiddenViewTargetCache;
+	Cache.Reset(ViewTargetPawn);
+
+	// internal helper func to hide all the components of an actor
+	auto AddToHiddenComponents = [&Cache](AActor* Actor)
+	{
+		Cache.WatchedActors.Emplace(Actor, Actor->GetComponents().Num());
+
+		TInlineComponentArray<UPrimitiveComponent*> Components;
+		Actor->GetComponents(Components);
+
+		// add every component and all attached children
+		for (UPrimitiveComponent* Comp : Components)
+		{
+			if (Comp->IsRegistered())
+			{
+				Cache.HiddenComponents.Add(Comp);
+
+				// Watch the children of every component, not only the ones that have some right now, so a later attach is noticed
+				const TArray<TObjectPtr<USceneComponent>>& AttachChildren = Comp->GetAttachChildren();
+				TArray<TWeakObjectPtr<USceneComponent>>& WatchedChildren = Cache.WatchedAttachParents.Emplace_GetRef(Comp, TArray<TWeakObjectPtr<USceneComponent>>()).Value;
+				WatchedChildren.Reserve(AttachChildren.Num());
+				for (USceneComponent* AttachedChild : AttachChildren)
+				{
+					WatchedChildren.Add(AttachedChild);
+				}
+
+				for (USceneComponent* AttachedChild : AttachChildren)
+				{
+					static FName NAME_NoParentAutoHide(TEXT("NoParentAutoHide"));
+					UPrimitiveComponent* AttachChildPC = Cast<UPrimitiveComponent>(AttachedChild);
+					if (AttachChildPC && AttachChildPC->IsRegistered() && !AttachChildPC->ComponentTags.Contains(NAME_NoParentAutoHide))
 					{
-						OutHiddenComponents.Add(Comp->GetPrimitiveSceneId());
-
-						for (USceneComponent* AttachedChild : Comp->GetAttachChildren())
-						{
-							static FName NAME_NoParentAutoHide(TEXT("NoParentAutoHide"));
-							UPrimitiveComponent* AttachChildPC = Cast<UPrimitiveComponent>(AttachedChild);
-							if (AttachChildPC && AttachChildPC->IsRegistered() && !AttachChildPC->ComponentTags.Contains(NAME_NoParentAutoHide))
-							{
-								OutHiddenComponents.Add(AttachChildPC->GetPrimitiveSceneId());
-							}
-						}
+						Cache.HiddenComponents.Add(AttachChildPC);
 					}
 				}
-			};
+			}
+		}
+	};
 
-			//TODO Solve with an interface.  Gather hidden components or something.
-			//TODO Hiding isn't awesome, sometimes you want the effect of a fade out over a proximity, needs to bubble up to designers.
+	// hide pawn's components
+	AddToHiddenComponents(ViewTargetPawn);
 
-			// hide pawn's components
-			TInlineComponentArray<UPrimitiveComponent*> PawnComponents;
-			ViewTargetPawn->GetComponents(PawnComponents);
-			AddToHiddenComponents(PawnComponents);
-
-			//// hide weapon too
-			//if (ViewTargetPawn->CurrentWeapon)
-			//{
-			//	TInlineComponentArray<UPrimitiveComponent*> WeaponComponents;
-			//	ViewTargetPawn->CurrentWeapon->GetComponents(WeaponComponents);
-			//	AddToHiddenComponents(WeaponComponents);
-			//}
+	// hide the equipped weapons too
+	if (const ULyraEquipmentManagerComponent* EquipmentManager = ViewTargetPawn->FindComponentByClass<ULyraEquipmentManagerComponent>())
+	{
+		for (const ULyraEquipmentInstance* EquipmentInstance : EquipmentManager->GetEquipmentInstancesOfType(ULyraEquipmentInstance::StaticClass()))
+		{
+			for (AActor* SpawnedActor : EquipmentInstance->GetSpawnedActors())
+			{
+				if (IsValid(SpawnedActor))
+				{
+					AddToHiddenComponents(SpawnedActor);
+				}
+			}
 		}
-
-		// we consumed it, reset for next frame
-		bHideViewTargetPawnNextFrame = false;
 	}
 }
 
+void ALyraPlayerController::OnHiddenViewTargetCharacterPartsChanged(ULyraPawnComponent_CharacterParts* ComponentWithChangedParts)
+{
+	HiddenViewTargetCache.bDirty = true;
+}
+
 void ALyraPlayerController::SetGenericTeamId(const FGenericTeamId& NewTeamID)
 {
 	UE_LOG(LogLyraTeams, Error, TEXT("You can't set the team ID on a player controller (%s); it's driven by the associated player state"), *GetPathNameSafe(this));
@@ -543,6 +615,72 @@ void ALyraPlayerController::OnUnPossess()
 	Super::OnUnPossess();
 }
 
+//////////////////////////////////////////////////////////////////////
+// FLyraHiddenViewTargetCache
+
+bool FLyraHiddenViewTargetCache::IsValidFor(const AActor* InViewTarget) const
+{
+	if (bDirty || (ViewTarget.Get() != InViewTarget))
+	{
+		return false;
+	}
+
+	for (const TPair<TWeakObjectPtr<AActor>, int32>& WatchedActor : WatchedActors)
+	{
+		const AActor* Actor = WatchedActor.Key.Get();
+		if (!Actor || (Actor->GetComponents().Num() != WatchedActor.Value))
+		{
+			return false;
+		}
+	}
+
+	// A component removed and another added in the same frame keeps the count, but the removed one is no longer registered
+	for (const TWeakObjectPtr<UPrimitiveComponent>& HiddenComponent : HiddenComponents)
+	{
+		const UPrimitiveComponent* Comp = HiddenComponent.Get();
+		if (!Comp || !Comp->IsRegistered())
+		{
+			return false;
+		}
+	}
+
+	// Compare the children themselves rather than their count, so a detach and an attach in the same frame are caught
+	for (const TPair<TWeakObjectPtr<USceneComponent>, TArray<TWeakObjectPtr<USceneComponent>>>& WatchedAttachParent : WatchedAttachParents)
+	{
+		const USceneComponent* AttachParent = WatchedAttachParent.Key.Get();
+		if (!AttachParent)
+		{
+			return false;
+		}
+
+		const TArray<TObjectPtr<USceneComponent>>& AttachChildren = AttachParent->GetAttachChildren();
+		const TArray<TWeakObjectPtr<USceneComponent>>& WatchedChildren = WatchedAttachParent.Value;
+		if (AttachChildren.Num() != WatchedChildren.Num())
+		{
+			return false;
+		}
+
+		for (int32 ChildIndex = 0; ChildIndex < AttachChildren.Num(); ++ChildIndex)
+		{
+			if (WatchedChildren[ChildIndex].Get() != AttachChildren[ChildIndex])
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void FLyraHiddenViewTargetCache::Reset(AActor* InViewTarget)
+{
+	ViewTarget = InViewTarget;
+	HiddenComponents.Reset();
+	WatchedActors.Reset();
+	WatchedAttachParents.Reset();
+	bDirty = false;
+}
+
 //////////////////////////////////////////////////////////////////////
 // ALyraReplayPlayerController
 
@@ -17,11 +17,39 @@ class APlayerState;
 class FPrimitiveComponentId;
 class IInputInterface;
 class ULyraAbilitySystemComponent;
+class ULyraPawnComponent_CharacterParts;
 class ULyraSettingsShared;
 class UObject;
 class UPlayer;
+class UPrimitiveComponent;
+class USceneComponent;
 struct FFrame;
 
+/**
+ * The components hidden while the camera is inside the view target, kept between frames.
+ * The set is rebuilt when the view target changes, one of the watched actors gains or loses components,
+ * a hidden component is unregistered, the attach children of any hidden component change, or the character parts change.
+ */
+struct FLyraHiddenViewTargetCache
+{
+	/** Returns true if the cached set can still be used for this view target */
+	bool IsValidFor(const AActor* InViewTarget) const;
+
+	void Reset(AActor* InViewTarget);
+
+	TWeakObjectPtr<AActor> ViewTarget;
+
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> HiddenComponents;
+
+	/** Actors the set was built from, with their component counts at the time */
+	TArray<TPair<TWeakObjectPtr<AActor>, int32>> WatchedActors;
+
+	/** Every registered primitive of the watched actors, with its attach children at the time */
+	TArray<TPair<TWeakObjectPtr<USceneComponent>, TArray<TWeakObjectPtr<USceneComponent>>>> WatchedAttachParents;
+
+	bool bDirty = true;
+};
+
 /**
  * ALyraPlayerController
  *
@@ -82,6 +110,7 @@ public:
 	virtual void AddCheats(bool bForce) override;
 	virtual void UpdateForceFeedback(IInputInterface* InputInterface, const int32 ControllerId) override;
 	virtual void UpdateHiddenComponents(const FVector& ViewLocation, TSet<FPrimitiveComponentId>& OutHiddenComponents) override;
+	virtual void UpdateCameraManager(float DeltaSeconds) override;
 	virtual void PreProcessInput(const float DeltaTime, const bool bGamePaused) override;
 	virtual void PostProcessInput(const float DeltaTime, const bool bGamePaused) override;
 	//~End of APlayerController interface
@@ -138,6 +167,14 @@ protected:
 	void K2_OnEndAutoRun();
 
 	bool bHideViewTargetPawnNextFrame = false;
+
+private:
+	void RebuildHiddenViewTargetCache(AActor* ViewTargetPawn);
+
+	UFUNCTION()
+	void OnHiddenViewTargetCharacterPartsChanged(ULyraPawnComponent_CharacterParts* ComponentWithChangedParts);
+
+	FLyraHiddenViewTargetCache HiddenViewTargetCache;
 };
 
 
@@ -27,7 +27,7 @@ UAsyncAction_QueryReplays* UAsyncAction_QueryReplays::QueryReplays(APlayerContro
 
 void UAsyncAction_QueryReplays::Activate()
 {
-	ReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
+	ReplayStreamer = ULyraReplaySubsystem::CreateLocalReplayStreamer();
 
 	ResultList = NewObject<ULyraReplayList>();
 	if (ReplayStreamer.IsValid())
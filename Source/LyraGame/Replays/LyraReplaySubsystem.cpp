@@ -1,25 +1,114 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LyraReplaySubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "Engine/DemoNetDriver.h"
+#include "EngineUtils.h"
 #include "Internationalization/Text.h"
 #include "Misc/DateTime.h"
 #include "CommonUISettings.h"
 #include "ICommonUIModule.h"
+#include "HAL/FileManager.h"
+#include "LocalFileNetworkReplayStreaming.h"
 #include "LyraLogChannels.h"
+#include "Messages/LyraVerbMessage.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Player/LyraLocalPlayer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 #include "Settings/LyraSettingsLocal.h"
+#include "System/LyraReplicationGraphSettings.h"
+#include "Tasks/Task.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraReplaySubsystem)
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Platform_Trait_ReplaySupport, "Platform.Trait.ReplaySupport");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Elimination_Message, "Lyra.Elimination.Message");
+
+namespace LyraReplay
+{
+	static float DenseCheckpointWindow = 10.0f;
+	static FAutoConsoleVariableRef CVarDenseCheckpointWindow(TEXT("Lyra.Replay.DenseCheckpointWindow"), DenseCheckpointWindow, TEXT("Seconds after an elimination during which extra checkpoints are recorded"), ECVF_Default);
+
+	static float DenseCheckpointInterval = 2.0f;
+	static FAutoConsoleVariableRef CVarDenseCheckpointInterval(TEXT("Lyra.Replay.DenseCheckpointInterval"), DenseCheckpointInterval, TEXT("Seconds between the extra checkpoints recorded after an elimination"), ECVF_Default);
+
+	static float ScrubSnapTolerance = 0.5f;
+	static FAutoConsoleVariableRef CVarScrubSnapTolerance(TEXT("Lyra.Replay.ScrubSnapTolerance"), ScrubSnapTolerance, TEXT("While scrubbing, seeks within this many seconds after a keyframe snap to it"), ECVF_Default);
+
+	static bool bRecordServerReplays = false;
+	static FAutoConsoleVariableRef CVarRecordServerReplays(TEXT("Lyra.Replay.RecordServerReplays"), bRecordServerReplays, TEXT("Should dedicated servers record a replay of every match"), ECVF_Default);
+
+	static FString ServerReplayStreamer = TEXT("LyraReplayStreaming");
+	static FAutoConsoleVariableRef CVarServerReplayStreamer(TEXT("Lyra.Replay.ServerReplayStreamer"), ServerReplayStreamer, TEXT("Replay streaming factory used for server replays, empty uses the default streamer"), ECVF_Default);
+
+	static float CleanupDelay = 10.0f;
+	static FAutoConsoleVariableRef CVarCleanupDelay(TEXT("Lyra.Replay.CleanupDelay"), CleanupDelay, TEXT("Seconds to wait after a recording starts before old local replays are cleaned up"), ECVF_Default);
+
+	static constexpr int32 KeyframeIndexVersion = 1;
+
+	// Server replays are named with this prefix, so playback can pick the streamer they were recorded with
+	static const TCHAR* ServerReplayPrefix = TEXT("LyraServerReplay-");
+
+	// Returns the folder the local replays are saved in, or an empty string if they go through a streamer that doesn't keep one file per replay
+	static FString GetLocalReplayDirectory()
+	{
+		// Must match the factory picked by ULyraReplaySubsystem::CreateLocalReplayStreamer
+		FString FactoryName = ServerReplayStreamer;
+		if (FactoryName.IsEmpty())
+		{
+			GConfig->GetString(TEXT("NetworkReplayStreaming"), TEXT("DefaultFactoryName"), FactoryName, GEngineIni);
+		}
+
+		// The compressing streamer is a local file streamer created with the default path
+		if ((FactoryName == TEXT("LocalFileNetworkReplayStreaming")) || (FactoryName == TEXT("LyraReplayStreaming")))
+		{
+			return FLocalFileNetworkReplayStreamer::GetDefaultDemoSavePath();
+		}
+
+		return FString();
+	}
+
+	static void AddServerReplayStreamerOption(TArray<FString>& AdditionalOptions)
+	{
+		if (!ServerReplayStreamer.IsEmpty())
+		{
+			AdditionalOptions.Add(FString::Printf(TEXT("ReplayStreamerOverride=%s"), *ServerReplayStreamer));
+		}
+	}
+}
 
 ULyraReplaySubsystem::ULyraReplaySubsystem()
 {
 }
 
+void ULyraReplaySubsystem::Deinitialize()
+{
+	if (EliminationListenerHandle.IsValid())
+	{
+		EliminationListenerHandle.Unregister();
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(DenseCheckpointTickHandle);
+	DenseCheckpointTickHandle.Reset();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(CleanupDelayHandle);
+	CleanupDelayHandle.Reset();
+
+	KeyframeIndexWritePipe.WaitUntilEmpty();
+
+	StopServerReplayFilter();
+
+	Super::Deinitialize();
+}
+
 bool ULyraReplaySubsystem::DoesPlatformSupportReplays()
 {
 	if (ICommonUIModule::GetSettings().GetPlatformTraits().HasTag(GetPlatformSupportTraitTag()))
@@ -39,7 +128,17 @@ void ULyraReplaySubsystem::PlayReplay(ULyraReplayListEntry* Replay)
 	if (Replay != nullptr)
 	{
 		FString DemoName = Replay->StreamInfo.Name;
-		GetGameInstance()->PlayReplay(DemoName);
+		ResetSeekState();
+		LoadKeyframeIndex(DemoName);
+
+		// The default streamer can't decompress the chunks of server replays
+		TArray<FString> AdditionalOptions;
+		if (DemoName.StartsWith(LyraReplay::ServerReplayPrefix))
+		{
+			LyraReplay::AddServerReplayStreamerOption(AdditionalOptions);
+		}
+
+		GetGameInstance()->PlayReplay(DemoName, nullptr, AdditionalOptions);
 	}
 }
 
@@ -48,7 +147,17 @@ void ULyraReplaySubsystem::RecordClientReplay(APlayerController* PlayerControlle
 	if (ensure(DoesPlatformSupportReplays() && PlayerController))
 	{
 		FText FriendlyNameText = FText::Format(NSLOCTEXT("Lyra", "LyraReplayName_Format", "Client Replay {0}"), FText::AsDateTime(FDateTime::UtcNow(), EDateTimeStyle::Short, EDateTimeStyle::Short));
-		GetGameInstance()->StartRecordingReplay(FString(), FriendlyNameText.ToString());
+
+		// Name the stream ourselves so the keyframe index can be written next to it
+		ActiveReplayName = FString::Printf(TEXT("LyraClientReplay-%s"), *FDateTime::UtcNow().ToString(TEXT("%Y.%m.%d-%H.%M.%S")));
+		ActiveReplayKeyframes.Reset();
+		GetGameInstance()->StartRecordingReplay(ActiveReplayName, FriendlyNameText.ToString());
+
+		// Eliminations get extra checkpoints so seeking to them doesn't replay everything since the last periodic checkpoint
+		if (!EliminationListenerHandle.IsValid())
+		{
+			EliminationListenerHandle = UGameplayMessageSubsystem::Get(PlayerController).RegisterListener(TAG_Lyra_Elimination_Message, this, &ThisClass::OnEliminationMessage);
+		}
 
 		if (ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(PlayerController->GetLocalPlayer()))
 		{
@@ -59,25 +168,144 @@ void ULyraReplaySubsystem::RecordClientReplay(APlayerController* PlayerControlle
 	}
 }
 
+bool ULyraReplaySubsystem::ShouldRecordServerReplays()
+{
+	return LyraReplay::bRecordServerReplays && DoesPlatformSupportReplays();
+}
+
+void ULyraReplaySubsystem::RecordServerReplay()
+{
+	UGameInstance* GameInstance = GetGameInstance();
+	UWorld* World = GameInstance ? GameInstance->GetWorld() : nullptr;
+	if (!World || (World->GetNetMode() == NM_Client) || World->IsPlayingReplay() || GetDemoDriver())
+	{
+		return;
+	}
+
+	FText FriendlyNameText = FText::Format(NSLOCTEXT("Lyra", "LyraServerReplayName_Format", "Server Replay {0}"), FText::AsDateTime(FDateTime::UtcNow(), EDateTimeStyle::Short, EDateTimeStyle::Short));
+	FString ReplayName = FString::Printf(TEXT("%s%s"), LyraReplay::ServerReplayPrefix, *FDateTime::UtcNow().ToString(TEXT("%Y.%m.%d-%H.%M.%S")));
+	ActiveReplayName = ReplayName;
+	ActiveReplayKeyframes.Reset();
+
+	TArray<FString> AdditionalOptions;
+	LyraReplay::AddServerReplayStreamerOption(AdditionalOptions);
+
+	UE_LOG(LogLyra, Log, TEXT("LyraReplaySubsystem recording server replay %s"), *ReplayName);
+	GameInstance->StartRecordingReplay(ReplayName, FriendlyNameText.ToString(), AdditionalOptions);
+
+	if (GetDemoDriver())
+	{
+		StartServerReplayFilter(World);
+	}
+}
+
+TSharedPtr<INetworkReplayStreamer> ULyraReplaySubsystem::CreateLocalReplayStreamer()
+{
+	// The compressing streamer is a local file streamer that only decompresses chunks flagged as compressed
+	const TCHAR* FactoryName = LyraReplay::ServerReplayStreamer.IsEmpty() ? nullptr : *LyraReplay::ServerReplayStreamer;
+	return FNetworkReplayStreaming::Get().GetFactory(FactoryName).CreateReplayStreamer();
+}
+
+void ULyraReplaySubsystem::StartServerReplayFilter(UWorld* World)
+{
+	StopServerReplayFilter();
+
+	for (const FRepGraphActorClassSettings& ActorClassSettings : GetDefault<ULyraReplicationGraphSettings>()->ClassSettings)
+	{
+		if (ActorClassSettings.bExcludeFromServerReplays)
+		{
+			// Script classes of modules that aren't compiled in, like the debug only ones in shipping builds, are skipped quietly
+			const bool bIsScriptClass = FPackageName::IsScriptPackage(ActorClassSettings.ActorClass.ToString());
+			if (UClass* ExcludedClass = bIsScriptClass ? ActorClassSettings.ActorClass.ResolveClass() : ActorClassSettings.GetStaticActorClass())
+			{
+				UE_LOG(LogLyra, Log, TEXT("LyraReplaySubsystem excluding %s from server replays"), *ExcludedClass->GetName());
+				ServerReplayExcludedClasses.Add(ExcludedClass);
+			}
+		}
+	}
+
+	if (ServerReplayExcludedClasses.IsEmpty())
+	{
+		return;
+	}
+
+	// Only demo drivers look at this flag, so clearing it doesn't affect replication to the clients
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		ExcludeFromServerReplay(*It);
+	}
+
+	ServerReplayFilterWorld = World;
+	ServerReplayActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::HandleActorSpawnedForServerReplay));
+}
+
+void ULyraReplaySubsystem::StopServerReplayFilter()
+{
+	if (UWorld* World = ServerReplayFilterWorld.Get())
+	{
+		World->RemoveOnActorSpawnedHandler(ServerReplayActorSpawnedHandle);
+	}
+
+	ServerReplayFilterWorld.Reset();
+	ServerReplayActorSpawnedHandle.Reset();
+	ServerReplayExcludedClasses.Reset();
+}
+
+void ULyraReplaySubsystem::HandleActorSpawnedForServerReplay(AActor* Actor)
+{
+	ExcludeFromServerReplay(Actor);
+}
+
+void ULyraReplaySubsystem::ExcludeFromServerReplay(AActor* Actor) const
+{
+	for (const UClass* ExcludedClass : ServerReplayExcludedClasses)
+	{
+		if (Actor->IsA(ExcludedClass))
+		{
+			Actor->bRelevantForNetworkReplays = false;
+			return;
+		}
+	}
+}
+
 void ULyraReplaySubsystem::CleanupLocalReplays(ULocalPlayer* LocalPlayer, int32 NumReplaysToKeep)
 {
-	// TODO this was only tested with the generic file streamer and may not fully work with the save game streamer
-	// This only handles one delete at a time, and will loop until it gets an error or goes below NumReplaysToKeep
-	// It does it this way because each delete may involve a server or save game query that invalidates the replay list
+	// Only one cleanup runs at a time, it enumerates once and then deletes everything above the limit in bulk
 	if (LocalPlayer != nullptr && LocalPlayerDeletingReplays == nullptr && NumReplaysToKeep != 0)
 	{
 		LocalPlayerDeletingReplays = LocalPlayer;
 		DeletingReplaysNumberToKeep = NumReplaysToKeep;
+		NumPendingStreamerDeletes = 0;
+		NumReplaysDeleted = 0;
 
-		CurrentReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
-		if (CurrentReplayStreamer.IsValid())
-		{
-			// Use the default version to get old version replays as well
-			FNetworkReplayVersion EnumerateStreamsVersion;
+		CleanupDelayHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::StartLocalReplayCleanup), LyraReplay::CleanupDelay);
+	}
+}
 
-			CurrentReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, LocalPlayer->GetPlatformUserIndex(), FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsCompleteForDelete));
-		}
+bool ULyraReplaySubsystem::StartLocalReplayCleanup(float DeltaTime)
+{
+	CleanupDelayHandle.Reset();
+
+	if (!IsValid(LocalPlayerDeletingReplays))
+	{
+		FinishLocalReplayCleanup();
+		return false;
+	}
+
+	CurrentReplayStreamer = CreateLocalReplayStreamer();
+	if (CurrentReplayStreamer.IsValid())
+	{
+		// Use the default version to get old version replays as well
+		FNetworkReplayVersion EnumerateStreamsVersion;
+
+		CurrentReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, LocalPlayerDeletingReplays->GetPlatformUserIndex(), FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsCompleteForDelete));
+	}
+	else
+	{
+		FinishLocalReplayCleanup();
 	}
+
+	return false;
 }
 
 void ULyraReplaySubsystem::OnEnumerateStreamsCompleteForDelete(const FEnumerateStreamsResult& Result)
@@ -114,56 +342,327 @@ void ULyraReplaySubsystem::OnEnumerateStreamsCompleteForDelete(const FEnumerateS
 		}
 	}
 
-	if (StreamsToDelete.Num() > DeletingReplaysNumberToKeep)
+	if (StreamsToDelete.Num() <= DeletingReplaysNumberToKeep)
 	{
-		// Delete the first replay above the limit, if successful it won't be in the loop during the next loop
-		// If unsuccessful, it will stop looping
-		FString ReplayName = StreamsToDelete[DeletingReplaysNumberToKeep].Name;
-		UE_LOG(LogLyra, Log, TEXT("LyraReplaySubsystem asked to delete replay %s"), *ReplayName);
-		CurrentReplayStreamer->DeleteFinishedStream(ReplayName, LocalPlayerDeletingReplays->GetPlatformUserIndex(), FDeleteFinishedStreamCallback::CreateUObject(this, &ThisClass::OnDeleteReplay));
+		// We're below the limit already
+		FinishLocalReplayCleanup();
+		return;
 	}
-	else
+
+	TArray<FString> ReplayNames;
+	for (int32 StreamIndex = DeletingReplaysNumberToKeep; StreamIndex < StreamsToDelete.Num(); ++StreamIndex)
+	{
+		// Never delete the stream that is being recorded
+		if (!StreamsToDelete[StreamIndex].bIsLive && !StreamsToDelete[StreamIndex].Name.IsEmpty())
+		{
+			ReplayNames.Add(StreamsToDelete[StreamIndex].Name);
+		}
+	}
+
+	UE_LOG(LogLyra, Log, TEXT("LyraReplaySubsystem deleting %d replays above the limit of %d"), ReplayNames.Num(), DeletingReplaysNumberToKeep);
+
+	TArray<FString> KeyframeIndexPaths;
+	KeyframeIndexPaths.Reserve(ReplayNames.Num());
+	for (const FString& ReplayName : ReplayNames)
 	{
-		// We're below the limit so stop iterating
-		CurrentReplayStreamer = nullptr;
-		LocalPlayerDeletingReplays = nullptr;
-		DeletingReplaysNumberToKeep = 0;
+		KeyframeIndexPaths.Add(GetKeyframeIndexPath(ReplayName));
 	}
+
+	// The local file streamer keeps one file per replay in its demo folder, those are removed directly in parallel on a background thread
+	// Anything that isn't found there, or everything if the streamer doesn't keep files, is handed back to the streamer
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis = TWeakObjectPtr<ThisClass>(this), ReplayNames = MoveTemp(ReplayNames), KeyframeIndexPaths = MoveTemp(KeyframeIndexPaths), DemoPath = LyraReplay::GetLocalReplayDirectory()]()
+	{
+		TArray<bool> WasDeleted;
+		WasDeleted.SetNumZeroed(ReplayNames.Num());
+
+		ParallelFor(ReplayNames.Num(), [&](int32 ReplayIndex)
+		{
+			if (!DemoPath.IsEmpty())
+			{
+				const FString ReplayPath = FPaths::Combine(DemoPath, ReplayNames[ReplayIndex] + FNetworkReplayStreaming::GetReplayFileExtension());
+				if (IFileManager::Get().FileExists(*ReplayPath))
+				{
+					WasDeleted[ReplayIndex] = IFileManager::Get().Delete(*ReplayPath, false, false, true);
+				}
+			}
+			IFileManager::Get().Delete(*KeyframeIndexPaths[ReplayIndex], false, false, true);
+		});
+
+		int32 NumFilesDeleted = 0;
+		TArray<FString> StreamerReplayNames;
+		for (int32 ReplayIndex = 0; ReplayIndex < ReplayNames.Num(); ++ReplayIndex)
+		{
+			if (WasDeleted[ReplayIndex])
+			{
+				++NumFilesDeleted;
+			}
+			else
+			{
+				StreamerReplayNames.Add(ReplayNames[ReplayIndex]);
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, NumFilesDeleted, StreamerReplayNames = MoveTemp(StreamerReplayNames)]() mutable
+		{
+			if (ULyraReplaySubsystem* StrongThis = WeakThis.Get())
+			{
+				StrongThis->OnLocalReplayFilesDeleted(NumFilesDeleted, MoveTemp(StreamerReplayNames));
+			}
+		});
+	});
 }
 
-void ULyraReplaySubsystem::OnDeleteReplay(const FDeleteFinishedStreamResult& DeleteResult)
+void ULyraReplaySubsystem::OnLocalReplayFilesDeleted(int32 NumFilesDeleted, TArray<FString> StreamerReplayNames)
 {
-	if (!CurrentReplayStreamer.IsValid() || !IsValid(LocalPlayerDeletingReplays))
+	NumReplaysDeleted += NumFilesDeleted;
+
+	if (!CurrentReplayStreamer.IsValid() || !IsValid(LocalPlayerDeletingReplays) || StreamerReplayNames.IsEmpty())
 	{
-		// Lost context, don't do anything
+		FinishLocalReplayCleanup();
 		return;
 	}
 
-	if (DeleteResult.WasSuccessful())
+	// Issue the remaining deletes together instead of re-enumerating after each one
+	NumPendingStreamerDeletes = StreamerReplayNames.Num();
+	for (const FString& ReplayName : StreamerReplayNames)
 	{
-		// Enumerate list again to see if we're under the limit yet
-		FNetworkReplayVersion EnumerateStreamsVersion;
+		CurrentReplayStreamer->DeleteFinishedStream(ReplayName, LocalPlayerDeletingReplays->GetPlatformUserIndex(), FDeleteFinishedStreamCallback::CreateUObject(this, &ThisClass::OnDeleteReplay));
+	}
+}
 
-		CurrentReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, LocalPlayerDeletingReplays->GetPlatformUserIndex(), FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateUObject(this, &ThisClass::OnEnumerateStreamsCompleteForDelete));
+void ULyraReplaySubsystem::OnDeleteReplay(const FDeleteFinishedStreamResult& DeleteResult)
+{
+	if (DeleteResult.WasSuccessful())
+	{
+		++NumReplaysDeleted;
 	}
 	else
 	{
-		// Failed, stop trying to delete anything else
 		// TODO properly integrate with platform-specific error reporting
 		UE_LOG(LogLyra, Warning, TEXT("Failed to delete replay with error %d!"), (int32)DeleteResult.Result);
+	}
 
-		CurrentReplayStreamer = nullptr;
-		LocalPlayerDeletingReplays = nullptr;
-		DeletingReplaysNumberToKeep = 0;
+	if (--NumPendingStreamerDeletes <= 0)
+	{
+		FinishLocalReplayCleanup();
 	}
 }
 
+void ULyraReplaySubsystem::FinishLocalReplayCleanup()
+{
+	UE_LOG(LogLyra, Log, TEXT("LyraReplaySubsystem finished replay cleanup, %d replays deleted"), NumReplaysDeleted);
+
+	const int32 NumDeleted = NumReplaysDeleted;
+
+	CurrentReplayStreamer = nullptr;
+	LocalPlayerDeletingReplays = nullptr;
+	DeletingReplaysNumberToKeep = 0;
+	NumPendingStreamerDeletes = 0;
+	NumReplaysDeleted = 0;
+
+	OnLocalReplaysCleanedUp.Broadcast(NumDeleted);
+}
+
 void ULyraReplaySubsystem::SeekInActiveReplay(float TimeInSeconds)
+{
+	// A seek started on a demo driver that has since gone away will never complete
+	if (bSeekInProgress && (SeekingDemoDriver.Get() != GetDemoDriver()))
+	{
+		ResetSeekState();
+	}
+
+	if (bScrubbing)
+	{
+		// Only keep the latest target while a seek is in flight, intermediate scrub positions are never decoded
+		PendingSeekTime = SnapToKeyframe(TimeInSeconds);
+		if (!bSeekInProgress)
+		{
+			StartSeek(PendingSeekTime);
+		}
+		return;
+	}
+
+	StartSeek(TimeInSeconds);
+}
+
+void ULyraReplaySubsystem::SetScrubbing(bool bInScrubbing)
+{
+	bScrubbing = bInScrubbing;
+}
+
+void ULyraReplaySubsystem::StartSeek(float TimeInSeconds)
+{
+	if (UDemoNetDriver* DemoDriver = GetDemoDriver())
+	{
+		bSeekInProgress = true;
+		PendingSeekTime = -1.0f;
+		SeekingDemoDriver = DemoDriver;
+		DemoDriver->GotoTimeInSeconds(TimeInSeconds, FOnGotoTimeDelegate::CreateUObject(this, &ThisClass::OnSeekComplete));
+	}
+	else
+	{
+		ResetSeekState();
+	}
+}
+
+void ULyraReplaySubsystem::OnSeekComplete(bool bWasSuccessful)
+{
+	bSeekInProgress = false;
+	SeekingDemoDriver.Reset();
+
+	if (PendingSeekTime >= 0.0f)
+	{
+		StartSeek(PendingSeekTime);
+	}
+}
+
+void ULyraReplaySubsystem::ResetSeekState()
+{
+	bSeekInProgress = false;
+	PendingSeekTime = -1.0f;
+	SeekingDemoDriver.Reset();
+}
+
+float ULyraReplaySubsystem::SnapToKeyframe(float TimeInSeconds) const
+{
+	// Seeking to just after a checkpoint only needs a short fast forward, so snap to it when it's close
+	const int32 NextIndex = Algo::UpperBoundBy(ActiveReplayKeyframes, TimeInSeconds, &FLyraReplayKeyframe::TimeInSeconds);
+	if (NextIndex > 0)
+	{
+		const float KeyframeTime = ActiveReplayKeyframes[NextIndex - 1].TimeInSeconds;
+		if ((TimeInSeconds - KeyframeTime) <= LyraReplay::ScrubSnapTolerance)
+		{
+			return KeyframeTime;
+		}
+	}
+	return TimeInSeconds;
+}
+
+void ULyraReplaySubsystem::OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload)
+{
+	UDemoNetDriver* DemoDriver = GetDemoDriver();
+	if (!DemoDriver || !DemoDriver->IsRecording())
+	{
+		return;
+	}
+
+	AddKeyframe(Payload.Verb);
+
+	// Keep recording denser checkpoints for a while, eliminations tend to come in clusters
+	DenseCheckpointsEndTime = DemoDriver->GetDemoCurrentTime() + LyraReplay::DenseCheckpointWindow;
+	if (!DenseCheckpointTickHandle.IsValid() && LyraReplay::DenseCheckpointInterval > 0.0f)
+	{
+		DenseCheckpointTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::HandleDenseCheckpointTick), LyraReplay::DenseCheckpointInterval);
+	}
+}
+
+bool ULyraReplaySubsystem::HandleDenseCheckpointTick(float DeltaTime)
+{
+	UDemoNetDriver* DemoDriver = GetDemoDriver();
+	if (!DemoDriver || !DemoDriver->IsRecording() || (DemoDriver->GetDemoCurrentTime() > DenseCheckpointsEndTime))
+	{
+		DenseCheckpointTickHandle.Reset();
+		return false;
+	}
+
+	AddKeyframe(FGameplayTag());
+	return true;
+}
+
+void ULyraReplaySubsystem::AddKeyframe(const FGameplayTag& Reason)
 {
 	if (UDemoNetDriver* DemoDriver = GetDemoDriver())
 	{
-		DemoDriver->GotoTimeInSeconds(TimeInSeconds);
+		DemoDriver->RequestCheckpoint();
+
+		FLyraReplayKeyframe& Keyframe = ActiveReplayKeyframes.AddDefaulted_GetRef();
+		Keyframe.TimeInSeconds = DemoDriver->GetDemoCurrentTime();
+		Keyframe.Reason = Reason;
+
+		SaveKeyframeIndex();
+	}
+}
+
+FString ULyraReplaySubsystem::GetKeyframeIndexPath(const FString& ReplayName)
+{
+	// Kept next to the replay file, or in the default demo folder for streamers that don't keep files
+	FString ReplayDirectory = LyraReplay::GetLocalReplayDirectory();
+	if (ReplayDirectory.IsEmpty())
+	{
+		ReplayDirectory = FLocalFileNetworkReplayStreamer::GetDefaultDemoSavePath();
 	}
+
+	return FPaths::Combine(ReplayDirectory, ReplayName + TEXT(".keyframes.json"));
+}
+
+void ULyraReplaySubsystem::SaveKeyframeIndex()
+{
+	if (ActiveReplayName.IsEmpty())
+	{
+		return;
+	}
+
+	FString IndexJson;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&IndexJson);
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(TEXT("version"), LyraReplay::KeyframeIndexVersion);
+	JsonWriter->WriteArrayStart(TEXT("keyframes"));
+	for (const FLyraReplayKeyframe& Keyframe : ActiveReplayKeyframes)
+	{
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(TEXT("time"), Keyframe.TimeInSeconds);
+		JsonWriter->WriteValue(TEXT("reason"), Keyframe.Reason.ToString());
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+
+	// Written off the game thread, the pipe keeps the writes in order
+	KeyframeIndexWritePipe.Launch(UE_SOURCE_LOCATION, [IndexPath = GetKeyframeIndexPath(ActiveReplayName), IndexJson = MoveTemp(IndexJson)]()
+	{
+		FFileHelper::SaveStringToFile(IndexJson, *IndexPath);
+	});
+}
+
+void ULyraReplaySubsystem::LoadKeyframeIndex(const FString& ReplayName)
+{
+	ActiveReplayName = ReplayName;
+	ActiveReplayKeyframes.Reset();
+
+	FString IndexJson;
+	if (!FFileHelper::LoadFileToString(IndexJson, *GetKeyframeIndexPath(ReplayName)))
+	{
+		// Replays recorded without an index still seek, just through the periodic checkpoints only
+		return;
+	}
+
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(IndexJson);
+	const TArray<TSharedPtr<FJsonValue>>* Keyframes = nullptr;
+	if (!FJsonSerializer::Deserialize(JsonReader, RootObject) || !RootObject.IsValid() || !RootObject->TryGetArrayField(TEXT("keyframes"), Keyframes))
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Failed to read the keyframe index of replay %s"), *ReplayName);
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& KeyframeValue : *Keyframes)
+	{
+		const TSharedPtr<FJsonObject>* KeyframeObject = nullptr;
+		if (KeyframeValue->TryGetObject(KeyframeObject))
+		{
+			FLyraReplayKeyframe& Keyframe = ActiveReplayKeyframes.AddDefaulted_GetRef();
+			(*KeyframeObject)->TryGetNumberField(TEXT("time"), Keyframe.TimeInSeconds);
+
+			FString Reason;
+			if ((*KeyframeObject)->TryGetStringField(TEXT("reason"), Reason) && !Reason.IsEmpty())
+			{
+				Keyframe.Reason = FGameplayTag::RequestGameplayTag(FName(*Reason), false);
+			}
+		}
+	}
+
+	Algo::SortBy(ActiveReplayKeyframes, &FLyraReplayKeyframe::TimeInSeconds);
 }
 
 float ULyraReplaySubsystem::GetReplayLengthInSeconds() const
@@ -2,16 +2,22 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
+#include "GameFramework/GameplayMessageSubsystem.h"
 #include "NetworkReplayStreaming.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
+#include "Tasks/Pipe.h"
 
 #include "LyraReplaySubsystem.generated.h"
 
+class AActor;
 class UDemoNetDriver;
 class APlayerController;
+class UWorld;
 class ULocalPlayer;
 struct FFrame;
+struct FLyraVerbMessage;
 
 /** An available replay for display in the UI */
 UCLASS(BlueprintType)
@@ -54,6 +60,24 @@ public:
 	TArray<TObjectPtr<ULyraReplayListEntry>> Results;
 };
 
+/** A time in a replay that can be sought to quickly because a checkpoint was recorded there */
+USTRUCT(BlueprintType)
+struct FLyraReplayKeyframe
+{
+	GENERATED_BODY()
+
+	/** Time in the replay in seconds */
+	UPROPERTY(BlueprintReadOnly, Category=Replays)
+	float TimeInSeconds = 0.0f;
+
+	/** Verb of the message that caused the keyframe, empty for follow up keyframes */
+	UPROPERTY(BlueprintReadOnly, Category=Replays)
+	FGameplayTag Reason;
+};
+
+/** Called once a local replay cleanup has finished, with the number of replays that were deleted */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLyraLocalReplaysCleanedUp, int32 /*NumDeleted*/);
+
 /** Subsystem to handle recording/loading replays */
 UCLASS()
 class LYRAGAME_API ULyraReplaySubsystem : public UGameInstanceSubsystem
@@ -63,6 +87,10 @@ class LYRAGAME_API ULyraReplaySubsystem : public UGameInstanceSubsystem
 public:
 	ULyraReplaySubsystem();
 
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
 	/** Returns true if this platform supports replays at all */
 	UFUNCTION(BlueprintCallable, Category = Replays, BlueprintPure = false)
 	static bool DoesPlatformSupportReplays();
@@ -78,14 +106,51 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Replays)
 	void RecordClientReplay(APlayerController* PlayerController);
 
-	/** Starts deleting local replays starting with the oldest until there are NumReplaysToKeep or fewer */
+	/** Returns true if dedicated servers should record a replay of every match */
+	static bool ShouldRecordServerReplays();
+
+	/**
+	 * Starts recording a replay of the whole match on the server. The chunks are streamed to disk through the
+	 * compressing streamer, and classes marked as cosmetic in the replication graph settings are left out.
+	 */
+	UFUNCTION(BlueprintCallable, Category = Replays)
+	void RecordServerReplay();
+
+	/** Returns the stream name of the replay being recorded or played, empty if there is none */
+	const FString& GetActiveReplayName() const { return ActiveReplayName; }
+
+	/**
+	 * Creates a streamer for the replays saved on this machine. Whenever Lyra.Replay.ServerReplayStreamer is set (the default)
+	 * this is that streamer, which reads the plain client replays as well as the compressed server replays.
+	 */
+	static TSharedPtr<INetworkReplayStreamer> CreateLocalReplayStreamer();
+
+	/**
+	 * Starts deleting local replays starting with the oldest until there are NumReplaysToKeep or fewer.
+	 * The streams are enumerated once and every replay above the limit is deleted in a single background job,
+	 * OnLocalReplaysCleanedUp is broadcast on the game thread when it's done.
+	 */
 	UFUNCTION(BlueprintCallable, Category = Replays)
 	void CleanupLocalReplays(ULocalPlayer* LocalPlayer, int32 NumReplaysToKeep);
 
+	/** Broadcast when the cleanup started by CleanupLocalReplays has finished */
+	FOnLyraLocalReplaysCleanedUp OnLocalReplaysCleanedUp;
+
 	/** Move forward or back in currently playing replay */
 	UFUNCTION(BlueprintCallable, Category=Replays)
 	void SeekInActiveReplay(float TimeInSeconds);
 
+	/**
+	 * Enables scrub mode for the currently playing replay. While scrubbing only one seek is in flight at a time,
+	 * newer requests replace the pending one and targets close to a keyframe snap to it.
+	 */
+	UFUNCTION(BlueprintCallable, Category=Replays)
+	void SetScrubbing(bool bInScrubbing);
+
+	/** Gets the keyframes of the replay being recorded or played, e.g. to mark eliminations on a timeline */
+	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
+	TArray<FLyraReplayKeyframe> GetActiveReplayKeyframes() const { return ActiveReplayKeyframes; }
+
 	/** Gets length of current replay */
 	UFUNCTION(BlueprintCallable, Category = Replays, BlueprintPure = false)
 	float GetReplayLengthInSeconds() const;
@@ -102,8 +167,67 @@ private:
 
 	int32 DeletingReplaysNumberToKeep;
 
+	/** Delays the cleanup so it doesn't compete with loading into a match */
+	FTSTicker::FDelegateHandle CleanupDelayHandle;
+
+	/** Deletes still waiting on the replay streamer, for replays that aren't plain files */
+	int32 NumPendingStreamerDeletes = 0;
+	int32 NumReplaysDeleted = 0;
+
 	UDemoNetDriver* GetDemoDriver() const;
 
+	bool StartLocalReplayCleanup(float DeltaTime);
 	void OnEnumerateStreamsCompleteForDelete(const FEnumerateStreamsResult& Result);
+	void OnLocalReplayFilesDeleted(int32 NumFilesDeleted, TArray<FString> StreamerReplayNames);
 	void OnDeleteReplay(const FDeleteFinishedStreamResult& DeleteResult);
+	void FinishLocalReplayCleanup();
+
+	/** Path of the keyframe index written next to a local replay */
+	static FString GetKeyframeIndexPath(const FString& ReplayName);
+
+	void OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload);
+	bool HandleDenseCheckpointTick(float DeltaTime);
+	void AddKeyframe(const FGameplayTag& Reason);
+	void SaveKeyframeIndex();
+	void LoadKeyframeIndex(const FString& ReplayName);
+
+	void StartSeek(float TimeInSeconds);
+	void OnSeekComplete(bool bWasSuccessful);
+	void ResetSeekState();
+
+	/** Keeps the classes marked with bExcludeFromServerReplays out of the replay being recorded in World */
+	void StartServerReplayFilter(UWorld* World);
+	void StopServerReplayFilter();
+	void HandleActorSpawnedForServerReplay(AActor* Actor);
+	void ExcludeFromServerReplay(AActor* Actor) const;
+	float SnapToKeyframe(float TimeInSeconds) const;
+
+	/** Name of the replay being recorded or played */
+	FString ActiveReplayName;
+
+	/** Keyframes of the replay being recorded or played, sorted by time */
+	TArray<FLyraReplayKeyframe> ActiveReplayKeyframes;
+
+	FGameplayMessageListenerHandle EliminationListenerHandle;
+
+	/** Requests follow up checkpoints for a while after an elimination */
+	FTSTicker::FDelegateHandle DenseCheckpointTickHandle;
+	float DenseCheckpointsEndTime = 0.0f;
+
+	/** Serializes the index writes, which run off the game thread */
+	UE::Tasks::FPipe KeyframeIndexWritePipe{ TEXT("LyraReplayKeyframeIndex") };
+
+	bool bScrubbing = false;
+	bool bSeekInProgress = false;
+	float PendingSeekTime = -1.0f;
+
+	/** Classes left out of server replays, resolved from the replication graph class settings */
+	UPROPERTY()
+	TArray<TObjectPtr<UClass>> ServerReplayExcludedClasses;
+
+	TWeakObjectPtr<UWorld> ServerReplayFilterWorld;
+	FDelegateHandle ServerReplayActorSpawnedHandle;
+
+	/** Demo driver the seek in flight was started on, its goto delegate never fires if the driver goes away */
+	TWeakObjectPtr<UDemoNetDriver> SeekingDemoDriver;
 };
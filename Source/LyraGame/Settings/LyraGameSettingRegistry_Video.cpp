@@ -584,6 +584,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 		AdvancedGraphics->SetDisplayName(LOCTEXT("AdvancedGraphics_Name", "Advanced Graphics"));
 		Screen->AddSetting(AdvancedGraphics);
 
+		UGameSetting* AdaptiveQualitySetting = nullptr;
+
 		//----------------------------------------------------------------------------------
 		{
 			UGameSettingValueDiscreteDynamic_Bool* Setting = NewObject<UGameSettingValueDiscreteDynamic_Bool>();
@@ -605,6 +607,47 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 				}
 			}));
 
+			AdvancedGraphics->AddSetting(Setting);
+		}
+		//----------------------------------------------------------------------------------
+		{
+			UGameSettingValueDiscreteDynamic_Bool* Setting = NewObject<UGameSettingValueDiscreteDynamic_Bool>();
+			Setting->SetDevName(TEXT("AdaptiveQuality"));
+			Setting->SetDisplayName(LOCTEXT("AdaptiveQuality_Name", "Adaptive Quality"));
+			Setting->SetDescriptionRichText(LOCTEXT("AdaptiveQuality_Description", "Automatically lowers individual graphics quality options during play when the frame rate drops (for example, when a laptop heats up), and raises them back up to your chosen levels once there is headroom again."));
+
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(IsAdaptiveQualityEnabled));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetAdaptiveQualityEnabled));
+			Setting->SetDefaultValue(false);
+
+			Setting->AddEditCondition(MakeShared<FGameSettingEditCondition_FramePacingMode>(ELyraFramePacingMode::DesktopStyle));
+
+			AdvancedGraphics->AddSetting(Setting);
+
+			AdaptiveQualitySetting = Setting;
+		}
+		//----------------------------------------------------------------------------------
+		{
+			UGameSettingValueDiscreteDynamic_Bool* Setting = NewObject<UGameSettingValueDiscreteDynamic_Bool>();
+			Setting->SetDevName(TEXT("PersistAdaptiveQuality"));
+			Setting->SetDisplayName(LOCTEXT("PersistAdaptiveQuality_Name", "Remember Adaptive Quality Changes"));
+			Setting->SetDescriptionRichText(LOCTEXT("PersistAdaptiveQuality_Description", "Saves the graphics quality options chosen by Adaptive Quality so the next session starts from them."));
+
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(ShouldPersistAdaptiveQualityChanges));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetPersistAdaptiveQualityChanges));
+			Setting->SetDefaultValue(false);
+
+			Setting->AddEditCondition(MakeShared<FGameSettingEditCondition_FramePacingMode>(ELyraFramePacingMode::DesktopStyle));
+
+			Setting->AddEditDependency(AdaptiveQualitySetting);
+			Setting->AddEditCondition(MakeShared<FWhenCondition>([](const ULocalPlayer* LocalPlayer, FGameSettingEditableState& InOutEditState) {
+				const ULyraLocalPlayer* LyraLocalPlayer = CastChecked<ULyraLocalPlayer>(LocalPlayer);
+				if (!LyraLocalPlayer->GetLocalSettings()->IsAdaptiveQualityEnabled())
+				{
+					InOutEditState.Disable(LOCTEXT("AdaptiveQualityNeededForPersist", "This option only works if 'Adaptive Quality' is enabled."));
+				}
+			}));
+
 			AdvancedGraphics->AddSetting(Setting);
 		}
 	}
@@ -2,13 +2,18 @@
 
 #include "LyraSettingsLocal.h"
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
 #include "EnhancedActionKeyMapping.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Engine/World.h"
 #include "Misc/App.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CoreDelegates.h"
 #include "CommonInputSubsystem.h"
 #include "GenericPlatform/GenericPlatformFramePacer.h"
 #include "Player/LyraLocalPlayer.h"
+#include "Performance/LyraPerformanceStatSubsystem.h"
 #include "Performance/LyraPerformanceStatTypes.h"
 #include "PlayerMappableInputConfig.h"
 #include "EnhancedInputSubsystems.h"
@@ -80,6 +85,72 @@ static TAutoConsoleVariable<int32> CVarDeviceProfileDrivenMobileMaxFrameRate(
 	TEXT("Max FPS when being driven by device profile"),
 	ECVF_Default | ECVF_Preview);
 
+//////////////////////////////////////////////////////////////////////
+// Adaptive quality
+
+static TAutoConsoleVariable<float> CVarAdaptiveQualityTargetFPS(
+	TEXT("Lyra.AdaptiveQuality.TargetFPS"),
+	0.0f,
+	TEXT("Frame rate the adaptive quality governor tries to hold (<= 0 uses the same target as dynamic resolution)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAdaptiveQualityPercentile(
+	TEXT("Lyra.AdaptiveQuality.Percentile"),
+	0.9f,
+	TEXT("Percentile (0..1) of recent frame times compared against the target frame time"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAdaptiveQualityDownscaleThreshold(
+	TEXT("Lyra.AdaptiveQuality.DownscaleThreshold"),
+	0.05f,
+	TEXT("Fraction over the target frame time at which a scalability group is stepped down"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAdaptiveQualityUpscaleThreshold(
+	TEXT("Lyra.AdaptiveQuality.UpscaleThreshold"),
+	0.25f,
+	TEXT("Fraction under the target frame time at which a scalability group is stepped back up"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAdaptiveQualityMinSecondsBetweenDownscales(
+	TEXT("Lyra.AdaptiveQuality.MinSecondsBetweenDownscales"),
+	4.0f,
+	TEXT("Minimum time between two changes when the governor wants to step quality down"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAdaptiveQualityMinSecondsBetweenUpscales(
+	TEXT("Lyra.AdaptiveQuality.MinSecondsBetweenUpscales"),
+	20.0f,
+	TEXT("Minimum time between two changes when the governor wants to step quality back up"),
+	ECVF_Default);
+
+namespace LyraAdaptiveQuality
+{
+	// How often the governor looks at the recent frame times
+	static constexpr float EvaluationInterval = 0.5f;
+
+	struct FQualityGroup
+	{
+		const TCHAR* Name;
+		int32 Scalability::FQualityLevels::* Level;
+	};
+
+	// The groups the governor may change, ordered from the one we'd rather give up first to the one we'd rather keep.
+	// Texture quality is left alone as it trades memory rather than frame time.
+	static const FQualityGroup QualityGroups[] =
+	{
+		{ TEXT("Shadow"), &Scalability::FQualityLevels::ShadowQuality },
+		{ TEXT("GlobalIllumination"), &Scalability::FQualityLevels::GlobalIlluminationQuality },
+		{ TEXT("Reflection"), &Scalability::FQualityLevels::ReflectionQuality },
+		{ TEXT("Effects"), &Scalability::FQualityLevels::EffectsQuality },
+		{ TEXT("Foliage"), &Scalability::FQualityLevels::FoliageQuality },
+		{ TEXT("PostProcess"), &Scalability::FQualityLevels::PostProcessQuality },
+		{ TEXT("ViewDistance"), &Scalability::FQualityLevels::ViewDistanceQuality },
+		{ TEXT("AntiAliasing"), &Scalability::FQualityLevels::AntiAliasingQuality },
+		{ TEXT("Shading"), &Scalability::FQualityLevels::ShadingQuality },
+	};
+}
+
 //////////////////////////////////////////////////////////////////////
 
 static TAutoConsoleVariable<FString> CVarMobileQualityLimits(
@@ -343,6 +414,11 @@ ULyraSettingsLocal::ULyraSettingsLocal()
 		OnApplicationActivationStateChangedHandle = FSlateApplication::Get().OnApplicationActivationStateChanged().AddUObject(this, &ThisClass::OnAppActivationStateChanged);
 	}
 
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		OnEnginePreExitHandle = FCoreDelegates::OnEnginePreExit.AddUObject(this, &ThisClass::SavePendingAdaptiveQualityLevels);
+	}
+
 	SetToDefaults();
 }
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -412,6 +488,14 @@ void ULyraSettingsLocal::BeginDestroy()
 		FSlateApplication::Get().OnApplicationActivationStateChanged().Remove(OnApplicationActivationStateChangedHandle);
 	}
 
+	FCoreDelegates::OnEnginePreExit.Remove(OnEnginePreExitHandle);
+
+	if (AdaptiveQualityTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(AdaptiveQualityTickHandle);
+		AdaptiveQualityTickHandle.Reset();
+	}
+
 	Super::BeginDestroy();
 }
 
@@ -526,6 +610,9 @@ void ULyraSettingsLocal::ClampQualityLevelsToDeviceProfile(const Scalability::FQ
 
 void ULyraSettingsLocal::OnExperienceLoaded()
 {
+	// A map change is a good moment to write out the levels the governor settled on during the last one
+	SavePendingAdaptiveQualityLevels();
+
 	ReapplyThingsDueToPossibleDeviceProfileChange();
 }
 
@@ -653,6 +740,208 @@ void ULyraSettingsLocal::UpdateEffectiveFrameRateLimit()
 	}
 }
 
+void ULyraSettingsLocal::UpdateAdaptiveQualityGovernor()
+{
+	// Re-applying levels we persisted ourselves shouldn't lower the ceiling for the rest of the session
+	const bool bReapplyingOwnLevels = AdaptiveQualityTickHandle.IsValid() && (ScalabilityQuality == AdaptiveQualityLevels);
+	if (!bReapplyingOwnLevels)
+	{
+		AdaptiveQualityCeiling = ScalabilityQuality;
+	}
+	AdaptiveQualityLevels = ScalabilityQuality;
+	LastAdaptiveQualityChangeTime = FPlatformTime::Seconds();
+
+	// The governor would fight anyone tweaking scalability in the editor, so it only runs in cooked/standalone games
+	const bool bShouldRunGovernor = bEnableAdaptiveQuality && FApp::CanEverRender() && !GIsEditor;
+	if (bShouldRunGovernor && !AdaptiveQualityTickHandle.IsValid())
+	{
+		AdaptiveQualityTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::HandleAdaptiveQualityTick), LyraAdaptiveQuality::EvaluationInterval);
+	}
+	else if (!bShouldRunGovernor && AdaptiveQualityTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(AdaptiveQualityTickHandle);
+		AdaptiveQualityTickHandle.Reset();
+	}
+}
+
+bool ULyraSettingsLocal::CanAdaptQualityNow() const
+{
+	// Consoles and mobile have their own fixed quality/frame rate pairings
+	const ULyraPlatformSpecificRenderingSettings* PlatformSettings = ULyraPlatformSpecificRenderingSettings::Get();
+	if (PlatformSettings->FramePacingMode != ELyraFramePacingMode::DesktopStyle)
+	{
+		return false;
+	}
+
+	if (ShouldUseFrontendPerformanceSettings())
+	{
+		return false;
+	}
+
+	if (FSlateApplication::IsInitialized() && !FSlateApplication::Get().IsActive())
+	{
+		return false;
+	}
+
+	return true;
+}
+
+float ULyraSettingsLocal::GetAdaptiveQualityTargetFPS()
+{
+	const float DesiredFPS = CVarAdaptiveQualityTargetFPS.GetValueOnGameThread();
+	if (DesiredFPS > 0.0f)
+	{
+		return DesiredFPS;
+	}
+
+	// Use the same budget we hand to dynamic resolution (see UpdateDesktopFramePacing)
+	const float TargetFPS = GetEffectiveFrameRateLimit();
+	return (TargetFPS <= 0.0f) ? 60.0f : FMath::Clamp(TargetFPS, 30.0f, 60.0f);
+}
+
+bool ULyraSettingsLocal::HandleAdaptiveQualityTick(float DeltaTime)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_LyraSettingsLocal_HandleAdaptiveQualityTick);
+
+	const UGameInstance* GameInstance = (GEngine && GEngine->GameViewport) ? GEngine->GameViewport->GetGameInstance() : nullptr;
+	ULyraPerformanceStatSubsystem* StatSubsystem = GameInstance ? GameInstance->GetSubsystem<ULyraPerformanceStatSubsystem>() : nullptr;
+	if (StatSubsystem == nullptr)
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	if (!CanAdaptQualityNow())
+	{
+		// Don't judge the game by frames from menus or while backgrounded
+		StatSubsystem->ResetRecentFrameTimes();
+		LastAdaptiveQualityChangeTime = Now;
+		return true;
+	}
+
+	if (StatSubsystem->GetNumRecentFrameTimes() < (FLyraPerformanceStatCache::MaxRecentFrameTimes / 2))
+	{
+		return true;
+	}
+
+	const float TargetFrameTimeMS = 1000.0f / GetAdaptiveQualityTargetFPS();
+	const double PercentileFrameTimeMS = StatSubsystem->GetRecentFrameTimePercentile(CVarAdaptiveQualityPercentile.GetValueOnGameThread()) * 1000.0;
+	const double TimeSinceLastChange = Now - LastAdaptiveQualityChangeTime;
+
+	const LyraAdaptiveQuality::FQualityGroup* ChosenGroup = nullptr;
+	int32 OldLevel = 0;
+	int32 NewLevel = 0;
+
+	if (PercentileFrameTimeMS > TargetFrameTimeMS * (1.0f + CVarAdaptiveQualityDownscaleThreshold.GetValueOnGameThread()))
+	{
+		if (TimeSinceLastChange >= CVarAdaptiveQualityMinSecondsBetweenDownscales.GetValueOnGameThread())
+		{
+			// Step down the highest group, preferring the ones we'd rather give up first
+			for (const LyraAdaptiveQuality::FQualityGroup& Group : LyraAdaptiveQuality::QualityGroups)
+			{
+				const int32 Level = AdaptiveQualityLevels.*(Group.Level);
+				if (Level > OldLevel)
+				{
+					ChosenGroup = &Group;
+					OldLevel = Level;
+				}
+			}
+			NewLevel = OldLevel - 1;
+		}
+	}
+	else if (PercentileFrameTimeMS < TargetFrameTimeMS * (1.0f - CVarAdaptiveQualityUpscaleThreshold.GetValueOnGameThread()))
+	{
+		if (TimeSinceLastChange >= CVarAdaptiveQualityMinSecondsBetweenUpscales.GetValueOnGameThread())
+		{
+			// Restore the group furthest below the user's choice, preferring the ones we'd rather keep
+			int32 LargestDeficit = 0;
+			for (int32 Index = UE_ARRAY_COUNT(LyraAdaptiveQuality::QualityGroups) - 1; Index >= 0; --Index)
+			{
+				const LyraAdaptiveQuality::FQualityGroup& Group = LyraAdaptiveQuality::QualityGroups[Index];
+				const int32 Deficit = AdaptiveQualityCeiling.*(Group.Level) - AdaptiveQualityLevels.*(Group.Level);
+				if (Deficit > LargestDeficit)
+				{
+					ChosenGroup = &Group;
+					LargestDeficit = Deficit;
+				}
+			}
+			OldLevel = ChosenGroup ? AdaptiveQualityLevels.*(ChosenGroup->Level) : 0;
+			NewLevel = OldLevel + 1;
+		}
+	}
+
+	if (ChosenGroup != nullptr)
+	{
+		AdaptiveQualityLevels.*(ChosenGroup->Level) = NewLevel;
+		ApplyAdaptiveQualityLevels(ChosenGroup->Name, OldLevel, NewLevel, PercentileFrameTimeMS, TargetFrameTimeMS);
+
+		// Only judge the new levels by frames rendered with them
+		StatSubsystem->ResetRecentFrameTimes();
+	}
+
+	return true;
+}
+
+void ULyraSettingsLocal::SaveSettings()
+{
+	Super::SaveSettings();
+
+	// UGameUserSettings saves the levels the engine is currently running at, which are the governor's while it has lowered
+	// them. Unless the user opted in to keeping those, overwrite the groups the governor changes with the user's own levels.
+	const bool bRunningAdaptiveLevels = !bPersistAdaptiveQualityChanges
+		&& (Scalability::GetQualityLevels() == AdaptiveQualityLevels)
+		&& !(AdaptiveQualityLevels == ScalabilityQuality);
+
+	if (bRunningAdaptiveLevels)
+	{
+		const FString& ScalabilityIni = GIsEditor ? GEditorSettingsIni : GGameUserSettingsIni;
+		for (const LyraAdaptiveQuality::FQualityGroup& Group : LyraAdaptiveQuality::QualityGroups)
+		{
+			GConfig->SetInt(TEXT("ScalabilityGroups"), *FString::Printf(TEXT("sg.%sQuality"), Group.Name), ScalabilityQuality.*(Group.Level), ScalabilityIni);
+		}
+		GConfig->Flush(false, ScalabilityIni);
+	}
+
+	bAdaptiveQualitySavePending = false;
+}
+
+void ULyraSettingsLocal::SavePendingAdaptiveQualityLevels()
+{
+	if (bAdaptiveQualitySavePending)
+	{
+		SaveSettings();
+	}
+}
+
+void ULyraSettingsLocal::SetAdaptiveQualityLevelsForTesting(const Scalability::FQualityLevels& Levels)
+{
+	AdaptiveQualityLevels = Levels;
+	Scalability::SetQualityLevels(AdaptiveQualityLevels);
+}
+
+void ULyraSettingsLocal::ApplyAdaptiveQualityLevels(const TCHAR* GroupName, int32 OldLevel, int32 NewLevel, double PercentileFrameTimeMS, float TargetFrameTimeMS)
+{
+	UE_LOG(LogConsoleResponse, Log, TEXT("Adaptive quality: P%.0f frame time %.2f ms vs %.2f ms budget, changing %s quality from %d to %d%s"),
+		CVarAdaptiveQualityPercentile.GetValueOnGameThread() * 100.0f,
+		PercentileFrameTimeMS,
+		TargetFrameTimeMS,
+		GroupName,
+		OldLevel,
+		NewLevel,
+		bPersistAdaptiveQualityChanges ? TEXT(" (saved)") : TEXT(""));
+
+	Scalability::SetQualityLevels(AdaptiveQualityLevels);
+	LastAdaptiveQualityChangeTime = FPlatformTime::Seconds();
+
+	// Saving on every step would hitch, so the levels are written out on the next map change or at exit (see SavePendingAdaptiveQualityLevels)
+	if (bPersistAdaptiveQualityChanges)
+	{
+		ScalabilityQuality = AdaptiveQualityLevels;
+		bAdaptiveQualitySavePending = true;
+	}
+}
+
 int32 ULyraSettingsLocal::GetDefaultMobileFrameRate()
 {
 	return CVarDeviceProfileDrivenMobileDefaultFrameRate.GetValueOnGameThread();
@@ -933,6 +1222,11 @@ void ULyraSettingsLocal::RunAutoBenchmark(bool bSaveImmediately)
 void ULyraSettingsLocal::ApplyScalabilitySettings()
 {
 	Scalability::SetQualityLevels(ScalabilityQuality);
+
+	if (FApp::CanEverRender())
+	{
+		UpdateAdaptiveQualityGovernor();
+	}
 }
 
 float ULyraSettingsLocal::GetOverallVolume() const
@@ -1207,6 +1501,7 @@ void ULyraSettingsLocal::ApplyNonResolutionSettings()
 		ApplyDisplayGamma();
 		ApplySafeZoneScale();
 		UpdateGameModeDeviceProfileAndFps();
+		UpdateAdaptiveQualityGovernor();
 	}
 
 	PerfStatSettingsChangedEvent.Broadcast();
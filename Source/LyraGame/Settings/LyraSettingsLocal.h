@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "GameFramework/GameUserSettings.h"
 #include "InputCoreTypes.h"
 
@@ -50,6 +51,7 @@ public:
 	//~UGameUserSettings interface
 	virtual void SetToDefaults() override;
 	virtual void LoadSettings(bool bForceReload) override;
+	virtual void SaveSettings() override;
 	virtual void ConfirmVideoMode() override;
 	virtual float GetEffectiveFrameRateLimit() override;
 	virtual void ResetToCurrentSettings() override;
@@ -140,6 +142,61 @@ private:
 	UPROPERTY(Config)
 	float FrameRateLimit_WhenBackgrounded;
 
+	//////////////////////////////////////////////////////////////////
+	// Display - Adaptive quality
+public:
+	/** Returns true if individual scalability groups may be lowered/raised at runtime to hold the target frame rate */
+	UFUNCTION()
+	bool IsAdaptiveQualityEnabled() const { return bEnableAdaptiveQuality; }
+	UFUNCTION()
+	void SetAdaptiveQualityEnabled(bool bEnabled) { bEnableAdaptiveQuality = bEnabled; }
+
+	/**
+	 * Returns true if scalability changes made by the adaptive quality governor should be saved,
+	 * making them the starting (and maximum) levels for the next session
+	 */
+	UFUNCTION()
+	bool ShouldPersistAdaptiveQualityChanges() const { return bPersistAdaptiveQualityChanges; }
+	UFUNCTION()
+	void SetPersistAdaptiveQualityChanges(bool bEnabled) { bPersistAdaptiveQualityChanges = bEnabled; }
+
+	/** Saves the settings if the governor changed the levels since the last save and they should be persisted */
+	void SavePendingAdaptiveQualityLevels();
+
+	/** Applies these levels as if the governor had picked them, without changing the user's levels; only meant for automation tests */
+	void SetAdaptiveQualityLevelsForTesting(const Scalability::FQualityLevels& Levels);
+
+protected:
+	/** Starts or stops the adaptive quality governor based on the current settings, restarting from the applied scalability levels */
+	void UpdateAdaptiveQualityGovernor();
+
+private:
+	bool HandleAdaptiveQualityTick(float DeltaTime);
+	bool CanAdaptQualityNow() const;
+	float GetAdaptiveQualityTargetFPS();
+	void ApplyAdaptiveQualityLevels(const TCHAR* GroupName, int32 OldLevel, int32 NewLevel, double PercentileFrameTimeMS, float TargetFrameTimeMS);
+
+	UPROPERTY(Config)
+	bool bEnableAdaptiveQuality = false;
+	UPROPERTY(Config)
+	bool bPersistAdaptiveQualityChanges = false;
+
+	// The levels the user applied; the governor never raises a group above these
+	Scalability::FQualityLevels AdaptiveQualityCeiling;
+
+	// The levels currently applied by the governor
+	Scalability::FQualityLevels AdaptiveQualityLevels;
+
+	// Time of the last change made by the governor (or when it was started), used to rate limit decisions
+	double LastAdaptiveQualityChangeTime = 0.0;
+
+	FTSTicker::FDelegateHandle AdaptiveQualityTickHandle;
+
+	// Set when persisted governor changes haven't been saved yet
+	bool bAdaptiveQualitySavePending = false;
+
+	FDelegateHandle OnEnginePreExitHandle;
+
 	//////////////////////////////////////////////////////////////////
 	// Display - Mobile quality settings
 public:
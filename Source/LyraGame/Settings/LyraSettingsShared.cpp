@@ -9,6 +9,7 @@
 #include "Misc/ConfigCacheIni.h"
 #include "Player/LyraLocalPlayer.h"
 #include "Rendering/SlateRenderer.h"
+#include "UObject/UnrealType.h"
 #include "SubtitleDisplaySubsystem.h"
 #include "EnhancedInputSubsystems.h"
 #include "UserSettings/EnhancedInputUserSettings.h"
@@ -40,6 +41,8 @@ ULyraSettingsShared::ULyraSettingsShared()
 
 	GamepadMoveStickDeadZone = LyraSettingsSharedCVars::DefaultGamepadLeftStickInnerDeadZone;
 	GamepadLookStickDeadZone = LyraSettingsSharedCVars::DefaultGamepadRightStickInnerDeadZone;
+
+	RebuildInputSettingsSnapshot();
 }
 
 int32 ULyraSettingsShared::GetLatestDataVersion() const
@@ -101,6 +104,9 @@ void ULyraSettingsShared::SaveSettings()
 
 void ULyraSettingsShared::ApplySettings()
 {
+	// Loaded values bypass ChangeValueAndDirty
+	RebuildInputSettingsSnapshot();
+
 	ApplySubtitleOptions();
 	ApplyBackgroundAudioSettings();
 	ApplyCultureSettings();
@@ -114,6 +120,53 @@ void ULyraSettingsShared::ApplySettings()
 	}
 }
 
+//////////////////////////////////////////////////////////////////////
+
+static const TArray<const FDoubleProperty*>& GetScalarSettingProperties()
+{
+	static TArray<const FDoubleProperty*> ScalarSettingProperties = []()
+	{
+		TArray<const FDoubleProperty*> Properties;
+		for (TFieldIterator<FDoubleProperty> It(ULyraSettingsShared::StaticClass()); It; ++It)
+		{
+			if (ensureMsgf(Properties.Num() < FLyraInputSettingsSnapshot::MaxScalarSettings, TEXT("Increase FLyraInputSettingsSnapshot::MaxScalarSettings to read %s"), *It->GetName()))
+			{
+				Properties.Add(*It);
+			}
+		}
+		return Properties;
+	}();
+
+	return ScalarSettingProperties;
+}
+
+int32 FLyraInputSettingsSnapshot::FindScalarSettingIndex(FName SettingName)
+{
+	return GetScalarSettingProperties().IndexOfByPredicate([SettingName](const FDoubleProperty* Property) { return Property->GetFName() == SettingName; });
+}
+
+void ULyraSettingsShared::RebuildInputSettingsSnapshot()
+{
+	const TArray<const FDoubleProperty*>& ScalarSettingProperties = GetScalarSettingProperties();
+
+	FLyraInputSettingsSnapshot& Snapshot = InputSettingsSnapshot;
+	Snapshot.Version++;
+	Snapshot.NumScalarSettings = ScalarSettingProperties.Num();
+	for (int32 Index = 0; Index < ScalarSettingProperties.Num(); ++Index)
+	{
+		Snapshot.ScalarSettings[Index] = ScalarSettingProperties[Index]->GetPropertyValue_InContainer(this);
+	}
+
+	Snapshot.GamepadMoveStickDeadZone = GamepadMoveStickDeadZone;
+	Snapshot.GamepadLookStickDeadZone = GamepadLookStickDeadZone;
+	Snapshot.GamepadLookSensitivityPreset = GamepadLookSensitivityPreset;
+	Snapshot.GamepadTargetingSensitivityPreset = GamepadTargetingSensitivityPreset;
+	Snapshot.bInvertVerticalAxis = bInvertVerticalAxis;
+	Snapshot.bInvertHorizontalAxis = bInvertHorizontalAxis;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 void ULyraSettingsShared::SetColorBlindStrength(int32 InColorBlindStrength)
 {
 	InColorBlindStrength = FMath::Clamp(InColorBlindStrength, 0, 10);
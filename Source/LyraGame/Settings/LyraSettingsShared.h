@@ -53,6 +53,38 @@ enum class ELyraGamepadSensitivity : uint8
 
 class ULyraLocalPlayer;
 
+/**
+ * Plain copy of the shared settings read by the Lyra input modifiers on every input sample, so they don't need reflection
+ * or the settings object itself. ULyraSettingsShared rebuilds it whenever one of its settings changes.
+ */
+struct FLyraInputSettingsSnapshot
+{
+	/** Maximum number of double settings that can be read by name, see FindScalarSettingIndex */
+	static constexpr int32 MaxScalarSettings = 8;
+
+	/** Incremented every time the snapshot is rebuilt */
+	uint32 Version = 0;
+
+	/** Values of the double properties of ULyraSettingsShared, in the order returned by FindScalarSettingIndex */
+	double ScalarSettings[MaxScalarSettings] = {};
+	int32 NumScalarSettings = 0;
+
+	float GamepadMoveStickDeadZone = 0.0f;
+	float GamepadLookStickDeadZone = 0.0f;
+	ELyraGamepadSensitivity GamepadLookSensitivityPreset = ELyraGamepadSensitivity::Normal;
+	ELyraGamepadSensitivity GamepadTargetingSensitivityPreset = ELyraGamepadSensitivity::Normal;
+	bool bInvertVerticalAxis = false;
+	bool bInvertHorizontalAxis = false;
+
+	/** Returns the index of the named double setting in ScalarSettings, or INDEX_NONE if ULyraSettingsShared has no such property */
+	static int32 FindScalarSettingIndex(FName SettingName);
+
+	double GetScalarSetting(int32 Index, double DefaultValue) const
+	{
+		return (Index >= 0 && Index < NumScalarSettings) ? ScalarSettings[Index] : DefaultValue;
+	}
+};
+
 /**
  * ULyraSettingsShared - The "Shared" settings are stored as part of the USaveGame system, these settings are not machine
  * specific like the local settings, and are safe to store in the cloud - and 'share' them.  Using the save game system
@@ -96,6 +128,9 @@ public:
 
 	/** Applies the current settings to the player */
 	void ApplySettings();
+
+	/** Returns the input relevant settings, kept up to date as settings change */
+	const FLyraInputSettingsSnapshot& GetInputSettingsSnapshot() const { return InputSettingsSnapshot; }
 	
 public:
 	////////////////////////////////////////////////////////
@@ -368,6 +403,7 @@ private:
 		{
 			CurrentValue = NewValue;
 			bIsDirty = true;
+			RebuildInputSettingsSnapshot();
 			OnSettingChanged.Broadcast(this);
 			
 			return true;
@@ -376,5 +412,9 @@ private:
 		return false;
 	}
 
+	void RebuildInputSettingsSnapshot();
+
 	bool bIsDirty = false;
+
+	FLyraInputSettingsSnapshot InputSettingsSnapshot;
 };
@@ -27,6 +27,7 @@ static FAutoConsoleCommand CVarDumpLoadedAssets(
 
 //////////////////////////////////////////////////////////////////////
 
+// Both return the index of the new job, which can be passed to FLyraAssetManagerStartupJob::AddDependency on a later job
 #define STARTUP_JOB_WEIGHTED(JobFunc, JobWeight) StartupJobs.Add(FLyraAssetManagerStartupJob(#JobFunc, [this](const FLyraAssetManagerStartupJob& StartupJob, TSharedPtr<FStreamableHandle>& LoadHandle){JobFunc;}, JobWeight))
 #define STARTUP_JOB(JobFunc) STARTUP_JOB_WEIGHTED(JobFunc, 1.f)
 
@@ -195,51 +196,169 @@ void ULyraAssetManager::DoAllStartupJobs()
 	SCOPED_BOOT_TIMING("ULyraAssetManager::DoAllStartupJobs");
 	const double AllStartupJobsStartTime = FPlatformTime::Seconds();
 
-	if (IsRunningDedicatedServer())
+	// No need for periodic progress updates on a dedicated server, just run the jobs
+	const bool bReportProgress = !IsRunningDedicatedServer();
+
+	if (StartupJobs.Num() > 0)
 	{
-		// No need for periodic progress updates, just run the jobs
+		enum class EJobState : uint8
+		{
+			Pending,
+			Running,
+			Complete
+		};
+
+		const int32 NumJobs = StartupJobs.Num();
+
+		// Jobs can only wait on jobs declared before them, anything else is a setup error rather than a satisfied dependency
+		for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+		{
+			for (int32 DependencyIndex : StartupJobs[JobIndex].Dependencies)
+			{
+				checkf((DependencyIndex >= 0) && (DependencyIndex < JobIndex), TEXT("Startup job %s depends on invalid job index %d"), *StartupJobs[JobIndex].JobName, DependencyIndex);
+			}
+		}
+
+		TArray<EJobState> JobStates;
+		JobStates.Init(EJobState::Pending, NumJobs);
+
+		TArray<TSharedPtr<FStreamableHandle>> JobHandles;
+		JobHandles.SetNum(NumJobs);
+
+		TArray<float> JobProgress;
+		JobProgress.Init(0.0f, NumJobs);
+
+		float TotalJobValue = 0.0f;
 		for (const FLyraAssetManagerStartupJob& StartupJob : StartupJobs)
 		{
-			StartupJob.DoJob();
+			TotalJobValue += StartupJob.JobWeight;
 		}
-	}
-	else
-	{
-		if (StartupJobs.Num() > 0)
+
+		auto ReportOverallProgress = [&]()
+		{
+			if (bReportProgress && (TotalJobValue > 0.0f))
+			{
+				float AccumulatedJobValue = 0.0f;
+				for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+				{
+					AccumulatedJobValue += FMath::Clamp(JobProgress[JobIndex], 0.0f, 1.0f) * StartupJobs[JobIndex].JobWeight;
+				}
+				UpdateInitialGameContentLoadPercent(AccumulatedJobValue / TotalJobValue);
+			}
+		};
+
+		auto CompleteJob = [&](int32 JobIndex)
+		{
+			StartupJobs[JobIndex].SubstepProgressDelegate.Unbind();
+			StartupJobs[JobIndex].FinishJob(JobHandles[JobIndex]);
+			JobStates[JobIndex] = EJobState::Complete;
+			JobProgress[JobIndex] = 1.0f;
+			ReportOverallProgress();
+		};
+
+		auto AreDependenciesComplete = [&](int32 JobIndex)
 		{
-			float TotalJobValue = 0.0f;
-			for (const FLyraAssetManagerStartupJob& StartupJob : StartupJobs)
+			for (int32 DependencyIndex : StartupJobs[JobIndex].Dependencies)
 			{
-				TotalJobValue += StartupJob.JobWeight;
+				if (JobStates[DependencyIndex] != EJobState::Complete)
+				{
+					return false;
+				}
 			}
+			return true;
+		};
 
-			float AccumulatedJobValue = 0.0f;
-			for (FLyraAssetManagerStartupJob& StartupJob : StartupJobs)
+		auto StartJob = [&](int32 JobIndex)
+		{
+			if (bReportProgress)
 			{
-				const float JobValue = StartupJob.JobWeight;
-				StartupJob.SubstepProgressDelegate.BindLambda([This = this, AccumulatedJobValue, JobValue, TotalJobValue](float NewProgress)
+				StartupJobs[JobIndex].SubstepProgressDelegate.BindLambda([&JobProgress, &ReportOverallProgress, JobIndex](float NewProgress)
 					{
-						const float SubstepAdjustment = FMath::Clamp(NewProgress, 0.0f, 1.0f) * JobValue;
-						const float OverallPercentWithSubstep = (AccumulatedJobValue + SubstepAdjustment) / TotalJobValue;
-
-						This->UpdateInitialGameContentLoadPercent(OverallPercentWithSubstep);
+						JobProgress[JobIndex] = NewProgress;
+						ReportOverallProgress();
 					});
+			}
 
-				StartupJob.DoJob();
+			JobStates[JobIndex] = EJobState::Running;
+			JobHandles[JobIndex] = StartupJobs[JobIndex].StartJob();
 
-				StartupJob.SubstepProgressDelegate.Unbind();
+			if (!JobHandles[JobIndex].IsValid() || JobHandles[JobIndex]->HasLoadCompletedOrStalled() || JobHandles[JobIndex]->WasCanceled())
+			{
+				CompleteJob(JobIndex);
+			}
+		};
 
-				AccumulatedJobValue += JobValue;
+		// Jobs are started on the game thread in declaration order as soon as their dependencies are met (they are free to touch UObjects),
+		// while any streamable handles they return load concurrently with each other and with the jobs started after them
+		int32 NumCompleteJobs = 0;
+		while (NumCompleteJobs < NumJobs)
+		{
+			bool bMadeProgress = false;
 
-				UpdateInitialGameContentLoadPercent(AccumulatedJobValue / TotalJobValue);
+			for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+			{
+				if ((JobStates[JobIndex] == EJobState::Pending) && AreDependenciesComplete(JobIndex))
+				{
+					StartJob(JobIndex);
+					bMadeProgress = true;
+				}
+			}
+
+			int32 FirstRunningJobIndex = INDEX_NONE;
+			for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+			{
+				if (JobStates[JobIndex] == EJobState::Running)
+				{
+					const TSharedPtr<FStreamableHandle>& Handle = JobHandles[JobIndex];
+					if (Handle->HasLoadCompletedOrStalled() || Handle->WasCanceled())
+					{
+						CompleteJob(JobIndex);
+						bMadeProgress = true;
+					}
+					else if (FirstRunningJobIndex == INDEX_NONE)
+					{
+						FirstRunningJobIndex = JobIndex;
+					}
+				}
+			}
+
+			NumCompleteJobs = 0;
+			for (EJobState JobState : JobStates)
+			{
+				NumCompleteJobs += (JobState == EJobState::Complete) ? 1 : 0;
+			}
+
+			if (FirstRunningJobIndex != INDEX_NONE)
+			{
+				// Pumps async loading for all outstanding requests, not just this handle
+				JobHandles[FirstRunningJobIndex]->WaitUntilComplete(1.0f / 60.0f, false);
+			}
+			else if (!bMadeProgress && (NumCompleteJobs < NumJobs))
+			{
+				// Nothing is running and nothing could be started, so the remaining jobs have missing or circular dependencies
+				for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+				{
+					if (JobStates[JobIndex] == EJobState::Pending)
+					{
+						UE_LOG(LogLyra, Error, TEXT("Startup job \"%s\" has unsatisfiable dependencies, running it anyway"), *StartupJobs[JobIndex].JobName);
+						StartupJobs[JobIndex].Dependencies.Reset();
+						break;
+					}
+				}
 			}
 		}
-		else
+
+		for (const FLyraAssetManagerStartupJob& StartupJob : StartupJobs)
 		{
-			UpdateInitialGameContentLoadPercent(1.0f);
+			UE_LOG(LogLyra, Display, TEXT("  Startup job \"%s\": started at +%.2fs, took %.2fs"), *StartupJob.JobName, StartupJob.StartTime - AllStartupJobsStartTime, StartupJob.GetDurationSeconds());
 		}
 	}
 
+	if (bReportProgress)
+	{
+		UpdateInitialGameContentLoadPercent(1.0f);
+	}
+
 	StartupJobs.Empty();
 
 	UE_LOG(LogLyra, Display, TEXT("All startup jobs took %.2f seconds to complete"), FPlatformTime::Seconds() - AllStartupJobsStartTime);
@@ -15,6 +15,13 @@ struct FLyraAssetManagerStartupJob
 	float JobWeight;
 	mutable double LastUpdate = 0;
 
+	/** Indices of other startup jobs that must complete before this one is started */
+	TArray<int32> Dependencies;
+
+	/** Timing information recorded while the job runs, in seconds */
+	mutable double StartTime = 0.0;
+	mutable double EndTime = 0.0;
+
 	/** Simple job that is all synchronous */
 	FLyraAssetManagerStartupJob(const FString& InJobName, const TFunction<void(const FLyraAssetManagerStartupJob&, TSharedPtr<FStreamableHandle>&)>& InJobFunc, float InJobWeight)
 		: JobFunc(InJobFunc)
@@ -25,6 +32,25 @@ struct FLyraAssetManagerStartupJob
 	/** Perform actual loading, will return a handle if it created one */
 	TSharedPtr<FStreamableHandle> DoJob() const;
 
+	/** Runs the job function without waiting on the resulting handle, will return a handle if it created one */
+	TSharedPtr<FStreamableHandle> StartJob() const;
+
+	/** Called once the job and its handle (if any) are complete */
+	void FinishJob(const TSharedPtr<FStreamableHandle>& Handle) const;
+
+	/** Marks this job as requiring another job (by index in the startup job list, declared before this one) to complete first */
+	FLyraAssetManagerStartupJob& AddDependency(int32 JobIndex)
+	{
+		check(JobIndex != INDEX_NONE);
+		Dependencies.AddUnique(JobIndex);
+		return *this;
+	}
+
+	double GetDurationSeconds() const
+	{
+		return EndTime - StartTime;
+	}
+
 	void UpdateSubstepProgress(float NewProgress) const
 	{
 		SubstepProgressDelegate.ExecuteIfBound(NewProgress);
@@ -36,7 +62,7 @@ struct FLyraAssetManagerStartupJob
 		{
 			// StreamableHandle::GetProgress traverses() a large graph and is quite expensive
 			double Now = FPlatformTime::Seconds();
-			if (LastUpdate - Now > 1.0 / 60)
+			if (Now - LastUpdate > 1.0 / 60)
 			{
 				SubstepProgressDelegate.Execute(StreamableHandle->GetProgress());
 				LastUpdate = Now;
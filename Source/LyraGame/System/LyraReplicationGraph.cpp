@@ -40,6 +40,10 @@
 *		to simulated connections at a low, steady frequency, and to take advantage of serialization sharing. Auto proxy player states are replicated at higher frequency (to the
 *		owning connection only) via ULyraReplicationGraphNode_AlwaysRelevant_ForConnection.
 *		
+*		ULyraReplicationGraphNode_FastSharedScheduler_ForConnection
+*		Connection specific node that returns the FastShared pawns ordered by screen relevance, distance and frames since their last FastShared update to that connection.
+*		The FastShared path stops once its per frame bit budget is used, so this replaces the spatial frequency bucket order that would let far pawns starve near ones.
+*		
 *		UReplicationGraphNode_TearOff_ForConnection
 *		Connection specific node for handling tear off actors. This is created and managed in the base implementation of Replication Graph.
 *	
@@ -132,6 +136,21 @@ namespace Lyra::RepGraph
 	int32 EnableFastSharedPath = 1;
 	static FAutoConsoleVariableRef CVarLyraRepEnableFastSharedPath(TEXT("Lyra.RepGraph.EnableFastSharedPath"), EnableFastSharedPath, TEXT(""), ECVF_Default);
 
+	int32 PrioritizeFastSharedPath = 1;
+	static FAutoConsoleVariableRef CVarLyraRepPrioritizeFastSharedPath(TEXT("Lyra.RepGraph.PrioritizeFastSharedPath"), PrioritizeFastSharedPath, TEXT("Gather FastShared updates through a per connection priority scheduler instead of the spatial frequency buckets. Takes effect when the graph is created."), ECVF_Default);
+
+	float FastSharedPriorityHalfDistance = 3000.f;
+	static FAutoConsoleVariableRef CVarLyraRepFastSharedPriorityHalfDistance(TEXT("Lyra.RepGraph.FastSharedPriorityHalfDistance"), FastSharedPriorityHalfDistance, TEXT("Distance at which a pawn's FastShared priority is halved"), ECVF_Default);
+
+	float FastSharedOffscreenPriorityScale = 0.25f;
+	static FAutoConsoleVariableRef CVarLyraRepFastSharedOffscreenPriorityScale(TEXT("Lyra.RepGraph.FastSharedOffscreenPriorityScale"), FastSharedOffscreenPriorityScale, TEXT("Priority scale for pawns outside the viewer's field of view"), ECVF_Default);
+
+	float FastSharedOnscreenConeCos = 0.5f;
+	static FAutoConsoleVariableRef CVarLyraRepFastSharedOnscreenConeCos(TEXT("Lyra.RepGraph.FastSharedOnscreenConeCos"), FastSharedOnscreenConeCos, TEXT("Cosine of the half angle of the view cone treated as on screen"), ECVF_Default);
+
+	float FastSharedStarvationPriorityScale = 0.5f;
+	static FAutoConsoleVariableRef CVarLyraRepFastSharedStarvationPriorityScale(TEXT("Lyra.RepGraph.FastSharedStarvationPriorityScale"), FastSharedStarvationPriorityScale, TEXT("Priority added per frame since the pawn last sent a FastShared update to the connection, relative to its base priority"), ECVF_Default);
+
 	UReplicationDriver* ConditionalCreateReplicationDriver(UNetDriver* ForNetDriver, UWorld* World)
 	{
 		// Only create for GameNetDriver
@@ -181,6 +200,7 @@ void ULyraReplicationGraph::ResetGameWorldState()
 	Super::ResetGameWorldState();
 
 	AlwaysRelevantStreamingLevelActors.Empty();
+	FastSharedActors.Reset();
 
 	for (UNetReplicationGraphConnection* ConnManager : Connections)
 	{
@@ -461,7 +481,9 @@ void ULyraReplicationGraph::InitGlobalActorClassSettings()
 	UReplicationGraphNode_ActorListFrequencyBuckets::DefaultSettings.ListSize = 12;
 	UReplicationGraphNode_ActorListFrequencyBuckets::DefaultSettings.NumBuckets = Lyra::RepGraph::DynamicActorFrequencyBuckets;
 	UReplicationGraphNode_ActorListFrequencyBuckets::DefaultSettings.BucketThresholds.Reset();
-	UReplicationGraphNode_ActorListFrequencyBuckets::DefaultSettings.EnableFastPath = (Lyra::RepGraph::EnableFastSharedPath > 0);
+	// When prioritized, FastShared actors are gathered by ULyraReplicationGraphNode_FastSharedScheduler_ForConnection instead
+	bUsePrioritizedFastSharedPath = (Lyra::RepGraph::EnableFastSharedPath > 0) && (Lyra::RepGraph::PrioritizeFastSharedPath > 0);
+	UReplicationGraphNode_ActorListFrequencyBuckets::DefaultSettings.EnableFastPath = (Lyra::RepGraph::EnableFastSharedPath > 0) && !bUsePrioritizedFastSharedPath;
 	UReplicationGraphNode_ActorListFrequencyBuckets::DefaultSettings.FastPathFrameModulo = 1;
 
 	RPCSendPolicyMap.Reset();
@@ -570,6 +592,12 @@ void ULyraReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnect
 	RepGraphConnection->OnClientVisibleLevelNameRemove.AddUObject(AlwaysRelevantConnectionNode, &ULyraReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityRemove);
 
 	AddConnectionGraphNode(AlwaysRelevantConnectionNode, RepGraphConnection);
+
+	if (bUsePrioritizedFastSharedPath)
+	{
+		ULyraReplicationGraphNode_FastSharedScheduler_ForConnection* FastSharedSchedulerNode = CreateNewNode<ULyraReplicationGraphNode_FastSharedScheduler_ForConnection>();
+		AddConnectionGraphNode(FastSharedSchedulerNode, RepGraphConnection);
+	}
 }
 
 EClassRepNodeMapping ULyraReplicationGraph::GetMappingPolicy(UClass* Class)
@@ -581,6 +609,11 @@ EClassRepNodeMapping ULyraReplicationGraph::GetMappingPolicy(UClass* Class)
 
 void ULyraReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
 {
+	if (bUsePrioritizedFastSharedPath && ActorInfo.Class->IsChildOf(ALyraCharacter::StaticClass()))
+	{
+		FastSharedActors.ConditionalAdd(ActorInfo.Actor);
+	}
+
 	EClassRepNodeMapping Policy = GetMappingPolicy(ActorInfo.Class);
 	switch(Policy)
 	{
@@ -625,6 +658,11 @@ void ULyraReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActo
 
 void ULyraReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
 {
+	if (bUsePrioritizedFastSharedPath && ActorInfo.Class->IsChildOf(ALyraCharacter::StaticClass()))
+	{
+		FastSharedActors.RemoveFast(ActorInfo.Actor);
+	}
+
 	EClassRepNodeMapping Policy = GetMappingPolicy(ActorInfo.Class);
 	switch(Policy)
 	{
@@ -938,6 +976,78 @@ void ULyraReplicationGraphNode_PlayerStateFrequencyLimiter::LogNode(FReplication
 
 // ------------------------------------------------------------------------------
 
+void ULyraReplicationGraphNode_FastSharedScheduler_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	ULyraReplicationGraph* LyraGraph = CastChecked<ULyraReplicationGraph>(GetOuter());
+
+	PrioritizedActors.Reset();
+	ScheduledActorList.Reset();
+
+	const float DistancePctSq = FMath::Square(Lyra::RepGraph::FastSharedPathCullDistPct);
+	const float InvHalfDistance = 1.f / FMath::Max(Lyra::RepGraph::FastSharedPriorityHalfDistance, 1.f);
+
+	for (AActor* Actor : LyraGraph->FastSharedActors)
+	{
+		if (IsActorValidForReplicationGather(Actor) == false)
+		{
+			continue;
+		}
+
+		FConnectionReplicationActorInfo& ConnectionActorInfo = Params.ConnectionManager.ActorInfoMap.FindOrAdd(Actor);
+
+		// Same distance requirement the FastShared path applies, checked here so culled actors don't take part in the sort
+		const float MaxDistSq = ConnectionActorInfo.GetCullDistanceSquared() * DistancePctSq;
+		const FVector ActorLocation = Actor->GetActorLocation();
+
+		float BasePriority = 0.f;
+		for (const FNetViewer& Viewer : Params.Viewers)
+		{
+			const FVector ToActor = ActorLocation - Viewer.ViewLocation;
+			const float DistSq = ToActor.SizeSquared();
+			if ((MaxDistSq > 0.f) && (DistSq > MaxDistSq))
+			{
+				continue;
+			}
+
+			const float Dist = FMath::Sqrt(DistSq);
+			const bool bOnScreen = (ToActor | Viewer.ViewDir) >= (Lyra::RepGraph::FastSharedOnscreenConeCos * Dist);
+			const float ViewerPriority = (bOnScreen ? 1.f : Lyra::RepGraph::FastSharedOffscreenPriorityScale) / (1.f + Dist * InvHalfDistance);
+			BasePriority = FMath::Max(BasePriority, ViewerPriority);
+		}
+
+		if (BasePriority <= 0.f)
+		{
+			continue;
+		}
+
+		const uint32 FramesSinceUpdate = Params.ReplicationFrameNum - ConnectionActorInfo.FastPath_LastRepFrameNum;
+		const float Priority = BasePriority * (1.f + FramesSinceUpdate * Lyra::RepGraph::FastSharedStarvationPriorityScale);
+		PrioritizedActors.Add({ Actor, Priority });
+	}
+
+	PrioritizedActors.Sort([](const FPrioritizedActor& A, const FPrioritizedActor& B) { return A.Priority > B.Priority; });
+
+	for (const FPrioritizedActor& PrioritizedActor : PrioritizedActors)
+	{
+		ScheduledActorList.Add(PrioritizedActor.Actor);
+	}
+
+	if (ScheduledActorList.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(ScheduledActorList, EActorRepListTypeFlags::FastShared);
+	}
+}
+
+void ULyraReplicationGraphNode_FastSharedScheduler_ForConnection::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+	LogActorRepList(DebugInfo, TEXT("Scheduled"), ScheduledActorList);
+	DebugInfo.PopIndent();
+}
+
+// ------------------------------------------------------------------------------
+
 void ULyraReplicationGraph::PrintRepNodePolicies()
 {
 	UEnum* Enum = StaticEnum<EClassRepNodeMapping>();
@@ -38,6 +38,9 @@ public:
 
 	TMap<FName, FActorRepListRefView> AlwaysRelevantStreamingLevelActors;
 
+	/** Actors that send FastShared updates, prioritized per connection by ULyraReplicationGraphNode_FastSharedScheduler_ForConnection */
+	FActorRepListRefView FastSharedActors;
+
 #if WITH_GAMEPLAY_DEBUGGER
 	void OnGameplayDebuggerOwnerChange(AGameplayDebuggerCategoryReplicator* Debugger, APlayerController* OldOwner);
 #endif
@@ -61,6 +64,9 @@ private:
 
 	/** Classes that had their replication settings explictly set by code in ULyraReplicationGraph::InitGlobalActorClassSettings */
 	TArray<UClass*> ExplicitlySetClasses;
+
+	/** FastShared updates are gathered through the per connection scheduler node instead of the spatial frequency buckets */
+	bool bUsePrioritizedFastSharedPath = false;
 };
 
 UCLASS()
@@ -120,4 +126,34 @@ private:
 	
 	TArray<FActorRepListRefView> ReplicationActorLists;
 	FActorRepListRefView ForceNetUpdateReplicationActorList;
-};
\ No newline at end of file
+};
+
+/**
+	Connection specific node that returns the FastShared actors in priority order. The FastShared path stops sending once FastSharedPathConstants.MaxBitsPerFrame
+	is reached, so the order decides who gets starved under load. Actors are ordered by screen relevance and distance to the connection's viewers, scaled up by the
+	number of frames since they last sent a FastShared update to this connection so far away actors still get updates eventually.
+*/
+UCLASS()
+class ULyraReplicationGraphNode_FastSharedScheduler_ForConnection : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& Actor) override { }
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound=true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override { }
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+private:
+	struct FPrioritizedActor
+	{
+		AActor* Actor = nullptr;
+		float Priority = 0.0f;
+	};
+
+	TArray<FPrioritizedActor> PrioritizedActors;
+	FActorRepListRefView ScheduledActorList;
+};
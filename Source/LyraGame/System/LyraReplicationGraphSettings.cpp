@@ -8,4 +8,11 @@ ULyraReplicationGraphSettings::ULyraReplicationGraphSettings()
 {
 	CategoryName = TEXT("Game");
 	DefaultReplicationGraphClass = ULyraReplicationGraph::StaticClass();
+
+	SharedMovementQuantizationProfiles =
+	{
+		FLyraSharedMovementQuantizationProfile(2000.0f, EVectorQuantization::RoundTwoDecimals, ERotatorQuantization::ByteComponents, true, EVectorQuantization::RoundWholeNumber),
+		FLyraSharedMovementQuantizationProfile(6000.0f, EVectorQuantization::RoundOneDecimal, ERotatorQuantization::ByteComponents, true, EVectorQuantization::RoundWholeNumber),
+		FLyraSharedMovementQuantizationProfile(0.0f, EVectorQuantization::RoundWholeNumber, ERotatorQuantization::ByteComponents, false, EVectorQuantization::RoundWholeNumber),
+	};
 }
\ No newline at end of file
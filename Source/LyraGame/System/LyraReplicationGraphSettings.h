@@ -36,6 +36,28 @@ public:
 	UPROPERTY(EditAnywhere, Category = FastSharedPath, meta = (ConsoleVariable = "Lyra.RepGraph.FastSharedPathCullDistPct"))
 	float FastSharedPathCullDistPct = 0.80f;
 
+	// Send FastShared updates in per connection priority order instead of spatial list order, so far away pawns don't use up the budget before near ones.
+	UPROPERTY(EditAnywhere, Category = FastSharedPath, meta = (ConsoleVariable = "Lyra.RepGraph.PrioritizeFastSharedPath"))
+	bool bPrioritizeFastSharedPath = true;
+
+	// Distance at which a pawn's FastShared priority is halved.
+	UPROPERTY(EditAnywhere, Category = FastSharedPath, meta = (ForceUnits = cm, ConsoleVariable = "Lyra.RepGraph.FastSharedPriorityHalfDistance"))
+	float FastSharedPriorityHalfDistance = 3000.0f;
+
+	// Priority scale for pawns outside the viewer's field of view.
+	UPROPERTY(EditAnywhere, Category = FastSharedPath, meta = (ConsoleVariable = "Lyra.RepGraph.FastSharedOffscreenPriorityScale"))
+	float FastSharedOffscreenPriorityScale = 0.25f;
+
+	// Priority added per frame since the pawn last sent a FastShared update to the connection, relative to its base priority.
+	UPROPERTY(EditAnywhere, Category = FastSharedPath, meta = (ConsoleVariable = "Lyra.RepGraph.FastSharedStarvationPriorityScale"))
+	float FastSharedStarvationPriorityScale = 0.5f;
+
+	// Precision used for FastShared movement updates, ordered from the closest to the furthest distance bucket (at most 4 are used).
+	// The first profile should match the precision near viewers need, the following ones trade precision for bandwidth.
+	// Clients deserialize using the same profiles, so they must match between client and server.
+	UPROPERTY(config, EditAnywhere, Category = FastSharedPath)
+	TArray<FLyraSharedMovementQuantizationProfile> SharedMovementQuantizationProfiles;
+
 	UPROPERTY(EditAnywhere, Category = DestructionInfo, meta = (ForceUnits = cm, ConsoleVariable = "Lyra.RepGraph.DestructInfo.MaxDist"))
 	float DestructionInfoMaxDist = 30000.f;
 
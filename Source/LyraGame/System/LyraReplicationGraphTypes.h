@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Engine/EngineTypes.h"
 #include "ReplicationGraphTypes.h"
 #include "LyraReplicationGraphTypes.generated.h"
 
@@ -47,6 +48,11 @@ struct FRepGraphActorClassSettings
 	UPROPERTY(EditAnywhere, meta = (EditCondition = "bAddToRPC_Multicast_OpenChannelForClassMap"))
 	bool bRPC_Multicast_OpenChannelForClass = true;
 
+	// Cosmetic only classes can be left out of server replays to keep their recording cost down
+	// Applied by ULyraReplaySubsystem when a server replay starts, so it works with or without the replication graph
+	UPROPERTY(EditAnywhere)
+	bool bExcludeFromServerReplays = false;
+
 	UClass* GetStaticActorClass() const
 	{
 		UClass* StaticActorClass = nullptr;
@@ -73,4 +79,39 @@ struct FRepGraphActorClassSettings
 
 		return StaticActorClass;
 	}
-};
\ No newline at end of file
+};
+
+// How precisely FastShared movement (FSharedRepMovement) is sent for pawns, picked by the distance to the pawn's closest viewer
+USTRUCT()
+struct FLyraSharedMovementQuantizationProfile
+{
+	GENERATED_BODY()
+
+	FLyraSharedMovementQuantizationProfile() = default;
+
+	FLyraSharedMovementQuantizationProfile(float InMaxViewerDistance, EVectorQuantization InLocationQuantization, ERotatorQuantization InRotationQuantization, bool bInReplicateVelocity, EVectorQuantization InVelocityQuantization)
+		: MaxViewerDistance(InMaxViewerDistance)
+		, LocationQuantization(InLocationQuantization)
+		, RotationQuantization(InRotationQuantization)
+		, bReplicateVelocity(bInReplicateVelocity)
+		, VelocityQuantization(InVelocityQuantization)
+	{
+	}
+
+	// Pawns whose closest viewer is within this distance use this profile. Profiles are checked in order and the last one is used for anything further away.
+	UPROPERTY(EditAnywhere, meta = (ForceUnits = cm))
+	float MaxViewerDistance = 0.0f;
+
+	UPROPERTY(EditAnywhere)
+	EVectorQuantization LocationQuantization = EVectorQuantization::RoundTwoDecimals;
+
+	UPROPERTY(EditAnywhere)
+	ERotatorQuantization RotationQuantization = ERotatorQuantization::ByteComponents;
+
+	// If false, velocity is not sent and simulated proxies derive it from consecutive locations
+	UPROPERTY(EditAnywhere)
+	bool bReplicateVelocity = true;
+
+	UPROPERTY(EditAnywhere, meta = (EditCondition = "bReplicateVelocity"))
+	EVectorQuantization VelocityQuantization = EVectorQuantization::RoundWholeNumber;
+};
@@ -14,6 +14,8 @@
 #include "Inventory/LyraInventoryItemInstance.h"
 #include "Inventory/LyraInventoryManagerComponent.h"
 #include "Character/LyraPawnExtensionComponent.h"
+#include "IPAddress.h"
+#include "Tests/LyraSoakTestDriver.h"
 
 ULyraGameplayRpcRegistrationComponent* ULyraGameplayRpcRegistrationComponent::ObjectInstance = nullptr;
 ULyraGameplayRpcRegistrationComponent* ULyraGameplayRpcRegistrationComponent::GetInstance()
@@ -95,6 +97,8 @@ void ULyraGameplayRpcRegistrationComponent::RegisterAlwaysOnHttpCallbacks()
 		TEXT("Cheats"),
 		TEXT("raw"),
 		{ CommandDesc });
+
+	RegisterSoakTestHttpCallbacks();
 }
 
 void ULyraGameplayRpcRegistrationComponent::RegisterInMatchHttpCallbacks()
@@ -113,6 +117,37 @@ void ULyraGameplayRpcRegistrationComponent::RegisterInMatchHttpCallbacks()
 	
 }
 
+void ULyraGameplayRpcRegistrationComponent::RegisterSoakTestHttpCallbacks()
+{
+	const FExternalRpcArgumentDesc BotsDesc(TEXT("bots"), TEXT("int"), TEXT("How many bots to add to the match."), true);
+	const FExternalRpcArgumentDesc FireDesc(TEXT("fire"), TEXT("bool"), TEXT("Whether bots should run the scripted fire loop."), true);
+	const FExternalRpcArgumentDesc MoveDesc(TEXT("move"), TEXT("bool"), TEXT("Whether bots should run the scripted move loop."), true);
+	const FExternalRpcArgumentDesc DurationDesc(TEXT("duration"), TEXT("float"), TEXT("Seconds before the soak stops on its own, 0 runs until stopped."), true);
+
+	RegisterHttpCallback(FName(TEXT("StartSoak")),
+		FHttpPath("/soak/start"),
+		EHttpServerRequestVerbs::VERB_POST,
+		FHttpRequestHandler::CreateUObject(this, &ThisClass::HttpStartSoakCommand),
+		true,
+		TEXT("Soak"),
+		TEXT("raw"),
+		{ BotsDesc, FireDesc, MoveDesc, DurationDesc });
+
+	RegisterHttpCallback(FName(TEXT("StopSoak")),
+		FHttpPath("/soak/stop"),
+		EHttpServerRequestVerbs::VERB_POST,
+		FHttpRequestHandler::CreateUObject(this, &ThisClass::HttpStopSoakCommand),
+		true,
+		TEXT("Soak"));
+
+	RegisterHttpCallback(FName(TEXT("GetSoakMetrics")),
+		FHttpPath("/soak/metrics"),
+		EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateUObject(this, &ThisClass::HttpGetSoakMetricsCommand),
+		true,
+		TEXT("Soak"));
+}
+
 void ULyraGameplayRpcRegistrationComponent::RegisterFrontendHttpCallbacks()
 {
     // TODO: Add Matchmaking RPCs here
@@ -227,4 +262,96 @@ bool ULyraGameplayRpcRegistrationComponent::HttpGetPlayerVitalsCommand(const FHt
 	return true;
 }
 
-#endif
\ No newline at end of file
+bool ULyraGameplayRpcRegistrationComponent::IsLocalRequest(const FHttpServerRequest& Request)
+{
+	if (!Request.PeerAddress.IsValid())
+	{
+		return false;
+	}
+
+	const FString PeerAddress = Request.PeerAddress->ToString(false);
+	return (PeerAddress == TEXT("127.0.0.1")) || (PeerAddress == TEXT("::1")) || (PeerAddress == TEXT("::ffff:127.0.0.1"));
+}
+
+bool ULyraGameplayRpcRegistrationComponent::HttpStartSoakCommand(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	if (!IsLocalRequest(Request))
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateSimpleResponse(false, TEXT("Soak commands are only accepted from localhost"));
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	FLyraSoakTestParams Params;
+	if (Request.Body.Num() > 0)
+	{
+		TSharedPtr<FJsonObject> BodyObject = GetJsonObjectFromRequestBody(Request.Body);
+		if (!BodyObject.IsValid())
+		{
+			TUniquePtr<FHttpServerResponse> Response = CreateSimpleResponse(false, TEXT("Invalid body object"));
+			OnComplete(MoveTemp(Response));
+			return true;
+		}
+		Params.ReadFromJson(*BodyObject);
+	}
+
+	if (SoakTestDriver == nullptr)
+	{
+		SoakTestDriver = NewObject<ULyraSoakTestDriver>(this);
+	}
+
+	FString Error;
+	const bool bStarted = SoakTestDriver->StartSoak(FindGameWorld(), Params, Error);
+
+	TUniquePtr<FHttpServerResponse> Response = CreateSimpleResponse(bStarted, Error);
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+bool ULyraGameplayRpcRegistrationComponent::HttpStopSoakCommand(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	if (!IsLocalRequest(Request))
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateSimpleResponse(false, TEXT("Soak commands are only accepted from localhost"));
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	if (SoakTestDriver)
+	{
+		SoakTestDriver->StopSoak();
+	}
+
+	TUniquePtr<FHttpServerResponse> Response = CreateSimpleResponse(true);
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+bool ULyraGameplayRpcRegistrationComponent::HttpGetSoakMetricsCommand(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	if (!IsLocalRequest(Request))
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateSimpleResponse(false, TEXT("Soak commands are only accepted from localhost"));
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	if (SoakTestDriver == nullptr)
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateSimpleResponse(false, TEXT("No soak test has been started"));
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	FString ResponseStr;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&ResponseStr);
+	JsonWriter->WriteObjectStart();
+	SoakTestDriver->WriteMetrics(JsonWriter);
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(ResponseStr, TEXT("application/json"));
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+#endif
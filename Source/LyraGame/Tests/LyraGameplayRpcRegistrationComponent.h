@@ -8,6 +8,7 @@
 #include "Dom/JsonObject.h"
 #include "LyraGameplayRpcRegistrationComponent.generated.h"
 
+class ULyraSoakTestDriver;
 
 UCLASS()
 class LYRAGAME_API ULyraGameplayRpcRegistrationComponent : public UExternalRpcRegistrationComponent
@@ -56,6 +57,24 @@ public:
 	 */
 	bool HttpGetPlayerVitalsCommand(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+// These are RPCs used to drive long running soak tests. They are also registered on dedicated servers and only accept requests from localhost.
+
+	virtual void RegisterSoakTestHttpCallbacks();
+
+	/** Spawns bots and starts the scripted fire/move loops, see FLyraSoakTestParams for the accepted body fields */
+	bool HttpStartSoakCommand(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	bool HttpStopSoakCommand(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Returns the metrics gathered since the previous request as json */
+	bool HttpGetSoakMetricsCommand(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Returns true if the request came from the local machine */
+	static bool IsLocalRequest(const FHttpServerRequest& Request);
 #endif
 
+protected:
+	UPROPERTY(Transient)
+	TObjectPtr<ULyraSoakTestDriver> SoakTestDriver;
+
 };
\ No newline at end of file
@@ -0,0 +1,332 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraSoakTestDriver.h"
+
+#include "AbilitySystemGlobals.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameModes/LyraBotCreationComponent.h"
+#include "HAL/PlatformMemory.h"
+#include "LyraLogChannels.h"
+#include "NativeGameplayTags.h"
+#include "NavigationSystem.h"
+#include "UObject/UObjectArray.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LyraSoakTestDriver)
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Ability_Type_Action_WeaponFire, "Ability.Type.Action.WeaponFire");
+
+//////////////////////////////////////////////////////////////////////
+// FLyraSoakTestParams
+
+void FLyraSoakTestParams::ReadFromJson(const FJsonObject& JsonObject)
+{
+	JsonObject.TryGetNumberField(TEXT("bots"), NumBotsToAdd);
+	JsonObject.TryGetBoolField(TEXT("fire"), bScriptedFire);
+	JsonObject.TryGetBoolField(TEXT("move"), bScriptedMovement);
+	JsonObject.TryGetNumberField(TEXT("fireInterval"), FireIntervalSeconds);
+	JsonObject.TryGetNumberField(TEXT("moveInterval"), MoveIntervalSeconds);
+	JsonObject.TryGetNumberField(TEXT("moveRadius"), MoveRadius);
+	JsonObject.TryGetNumberField(TEXT("duration"), DurationSeconds);
+
+	NumBotsToAdd = FMath::Clamp(NumBotsToAdd, 0, 256);
+	FireIntervalSeconds = FMath::Max(FireIntervalSeconds, 0.05f);
+	MoveIntervalSeconds = FMath::Max(MoveIntervalSeconds, 0.1f);
+	MoveRadius = FMath::Max(MoveRadius, 100.0f);
+	DurationSeconds = FMath::Max(DurationSeconds, 0.0f);
+}
+
+//////////////////////////////////////////////////////////////////////
+// ULyraSoakTestDriver
+
+bool ULyraSoakTestDriver::StartSoak(UWorld* InWorld, const FLyraSoakTestParams& InParams, FString& OutError)
+{
+	if ((InWorld == nullptr) || (InWorld->GetNetMode() == NM_Client))
+	{
+		OutError = TEXT("Soak tests can only be started on a server or standalone game");
+		return false;
+	}
+
+	AGameStateBase* GameState = InWorld->GetGameState();
+	ULyraBotCreationComponent* BotComponent = GameState ? GameState->FindComponentByClass<ULyraBotCreationComponent>() : nullptr;
+	if ((BotComponent == nullptr) && (InParams.NumBotsToAdd > 0))
+	{
+		OutError = TEXT("The current experience has no bot creation component");
+		return false;
+	}
+
+	StopSoak();
+
+	Params = InParams;
+	SoakWorld = InWorld;
+
+#if WITH_SERVER_CODE
+	for (int32 BotIndex = 0; BotIndex < Params.NumBotsToAdd; ++BotIndex)
+	{
+		BotComponent->Cheat_AddBot();
+	}
+#endif
+
+	WindowFrameTimes.Reset();
+	WindowGameThreadTimes.Reset();
+	SoakStartTime = FPlatformTime::Seconds();
+	LastMetricsTime = SoakStartTime;
+	TotalFrames = 0;
+	WorstFrameTimeMs = 0.0f;
+	PeakObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	if (UNetDriver* NetDriver = InWorld->GetNetDriver())
+	{
+		LastInTotalBytes = NetDriver->InTotalBytes;
+		LastOutTotalBytes = NetDriver->OutTotalBytes;
+	}
+	else
+	{
+		LastInTotalBytes = 0;
+		LastOutTotalBytes = 0;
+	}
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::HandleTick));
+
+	UE_LOG(LogLyra, Log, TEXT("Soak test started: %d added bots, fire=%d, move=%d, duration=%.0fs"),
+		Params.NumBotsToAdd, Params.bScriptedFire ? 1 : 0, Params.bScriptedMovement ? 1 : 0, Params.DurationSeconds);
+
+	return true;
+}
+
+void ULyraSoakTestDriver::StopSoak()
+{
+	if (!TickHandle.IsValid())
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+
+	// Hand the bots back to their behavior trees
+	for (const auto& KVP : BotStates)
+	{
+		if (AAIController* BotController = KVP.Key.Get())
+		{
+			if (KVP.Value.bLogicStopped)
+			{
+				if (UBrainComponent* BrainComponent = BotController->GetBrainComponent())
+				{
+					BrainComponent->RestartLogic();
+				}
+			}
+		}
+	}
+	BotStates.Reset();
+
+	UE_LOG(LogLyra, Log, TEXT("Soak test stopped after %.0fs (%lld frames)"), FPlatformTime::Seconds() - SoakStartTime, TotalFrames);
+}
+
+void ULyraSoakTestDriver::BeginDestroy()
+{
+	StopSoak();
+
+	Super::BeginDestroy();
+}
+
+bool ULyraSoakTestDriver::HandleTick(float DeltaTime)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ULyraSoakTestDriver_HandleTick);
+
+	UWorld* World = SoakWorld.Get();
+	if (World == nullptr)
+	{
+		// The match ended underneath us
+		StopSoak();
+		return false;
+	}
+
+	const float FrameTimeMs = DeltaTime * 1000.0f;
+	if (WindowFrameTimes.Num() < MaxWindowSamples)
+	{
+		WindowFrameTimes.Add(FrameTimeMs);
+		WindowGameThreadTimes.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	}
+	WorstFrameTimeMs = FMath::Max(WorstFrameTimeMs, FrameTimeMs);
+	PeakObjectCount = FMath::Max(PeakObjectCount, GUObjectArray.GetObjectArrayNumMinusAvailable());
+	++TotalFrames;
+
+	const double TimeNow = FPlatformTime::Seconds();
+	for (FConstControllerIterator It = World->GetControllerIterator(); It; ++It)
+	{
+		if (AAIController* BotController = Cast<AAIController>(It->Get()))
+		{
+			UpdateBot(BotController, TimeNow);
+		}
+	}
+
+	if ((Params.DurationSeconds > 0.0f) && ((TimeNow - SoakStartTime) >= Params.DurationSeconds))
+	{
+		StopSoak();
+		return false;
+	}
+
+	return true;
+}
+
+void ULyraSoakTestDriver::UpdateBot(AAIController* BotController, double TimeNow)
+{
+	APawn* Pawn = BotController->GetPawn();
+	if (Pawn == nullptr)
+	{
+		// Dead and waiting to respawn
+		return;
+	}
+
+	FSoakBotState& BotState = BotStates.FindOrAdd(BotController);
+
+	if (Params.bScriptedMovement)
+	{
+		if (!BotState.bLogicStopped)
+		{
+			if (UBrainComponent* BrainComponent = BotController->GetBrainComponent())
+			{
+				BrainComponent->StopLogic(TEXT("Soak test"));
+			}
+			BotState.bLogicStopped = true;
+
+			// Spread the bots out so they don't all path on the same frame
+			BotState.NextMoveTime = TimeNow + FMath::FRand() * Params.MoveIntervalSeconds;
+			BotState.NextFireTime = TimeNow + FMath::FRand() * Params.FireIntervalSeconds;
+		}
+
+		if (TimeNow >= BotState.NextMoveTime)
+		{
+			BotState.NextMoveTime = TimeNow + Params.MoveIntervalSeconds;
+
+			FNavLocation Destination;
+			UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(BotController->GetWorld());
+			if (NavSystem && NavSystem->GetRandomReachablePointInRadius(Pawn->GetActorLocation(), Params.MoveRadius, Destination))
+			{
+				BotController->MoveToLocation(Destination.Location);
+			}
+		}
+	}
+
+	if (Params.bScriptedFire && (TimeNow >= BotState.NextFireTime))
+	{
+		BotState.NextFireTime = TimeNow + Params.FireIntervalSeconds;
+
+		if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Pawn))
+		{
+			ASC->TryActivateAbilitiesByTag(FGameplayTagContainer(TAG_Ability_Type_Action_WeaponFire));
+		}
+	}
+}
+
+float ULyraSoakTestDriver::ComputePercentile(TArray<float>& SortedScratch, const TArray<float>& Samples, float Percentile)
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	if (SortedScratch.Num() != Samples.Num())
+	{
+		SortedScratch = Samples;
+		SortedScratch.Sort();
+	}
+
+	const int32 Index = FMath::Clamp(FMath::FloorToInt32(Percentile * (SortedScratch.Num() - 1)), 0, SortedScratch.Num() - 1);
+	return SortedScratch[Index];
+}
+
+void ULyraSoakTestDriver::WriteMetrics(const TSharedRef<TJsonWriter<>>& JsonWriter)
+{
+	const double TimeNow = FPlatformTime::Seconds();
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	UWorld* World = SoakWorld.Get();
+
+	JsonWriter->WriteValue(TEXT("running"), IsSoakRunning());
+	JsonWriter->WriteValue(TEXT("elapsedSeconds"), TimeNow - SoakStartTime);
+	JsonWriter->WriteValue(TEXT("windowSeconds"), TimeNow - LastMetricsTime);
+	JsonWriter->WriteValue(TEXT("totalFrames"), TotalFrames);
+
+	JsonWriter->WriteObjectStart(TEXT("frameTimeMs"));
+	{
+		SortScratch.Reset();
+		JsonWriter->WriteValue(TEXT("samples"), WindowFrameTimes.Num());
+		JsonWriter->WriteValue(TEXT("p50"), ComputePercentile(SortScratch, WindowFrameTimes, 0.50f));
+		JsonWriter->WriteValue(TEXT("p90"), ComputePercentile(SortScratch, WindowFrameTimes, 0.90f));
+		JsonWriter->WriteValue(TEXT("p99"), ComputePercentile(SortScratch, WindowFrameTimes, 0.99f));
+		JsonWriter->WriteValue(TEXT("max"), SortScratch.Num() > 0 ? SortScratch.Last() : 0.0f);
+		JsonWriter->WriteValue(TEXT("worstOverall"), WorstFrameTimeMs);
+	}
+	JsonWriter->WriteObjectEnd();
+
+	JsonWriter->WriteObjectStart(TEXT("gameThreadMs"));
+	{
+		SortScratch.Reset();
+		JsonWriter->WriteValue(TEXT("p50"), ComputePercentile(SortScratch, WindowGameThreadTimes, 0.50f));
+		JsonWriter->WriteValue(TEXT("p90"), ComputePercentile(SortScratch, WindowGameThreadTimes, 0.90f));
+		JsonWriter->WriteValue(TEXT("p99"), ComputePercentile(SortScratch, WindowGameThreadTimes, 0.99f));
+	}
+	JsonWriter->WriteObjectEnd();
+
+	JsonWriter->WriteObjectStart(TEXT("memory"));
+	{
+		JsonWriter->WriteValue(TEXT("usedPhysical"), static_cast<int64>(MemoryStats.UsedPhysical));
+		JsonWriter->WriteValue(TEXT("peakUsedPhysical"), static_cast<int64>(MemoryStats.PeakUsedPhysical));
+		JsonWriter->WriteValue(TEXT("usedVirtual"), static_cast<int64>(MemoryStats.UsedVirtual));
+		JsonWriter->WriteValue(TEXT("peakUsedVirtual"), static_cast<int64>(MemoryStats.PeakUsedVirtual));
+	}
+	JsonWriter->WriteObjectEnd();
+
+	JsonWriter->WriteObjectStart(TEXT("objects"));
+	{
+		JsonWriter->WriteValue(TEXT("count"), GUObjectArray.GetObjectArrayNumMinusAvailable());
+		JsonWriter->WriteValue(TEXT("peak"), PeakObjectCount);
+	}
+	JsonWriter->WriteObjectEnd();
+
+	int32 NumPlayers = 0;
+	int32 NumBots = 0;
+	if (World)
+	{
+		for (FConstControllerIterator It = World->GetControllerIterator(); It; ++It)
+		{
+			if (Cast<AAIController>(It->Get()))
+			{
+				++NumBots;
+			}
+			else if (Cast<APlayerController>(It->Get()))
+			{
+				++NumPlayers;
+			}
+		}
+	}
+	JsonWriter->WriteValue(TEXT("players"), NumPlayers);
+	JsonWriter->WriteValue(TEXT("bots"), NumBots);
+
+	JsonWriter->WriteObjectStart(TEXT("net"));
+	if (UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr)
+	{
+		const uint64 InTotalBytes = NetDriver->InTotalBytes;
+		const uint64 OutTotalBytes = NetDriver->OutTotalBytes;
+
+		JsonWriter->WriteValue(TEXT("connections"), NetDriver->ClientConnections.Num());
+		JsonWriter->WriteValue(TEXT("inBytesPerSecond"), static_cast<int64>(NetDriver->InBytesPerSecond));
+		JsonWriter->WriteValue(TEXT("outBytesPerSecond"), static_cast<int64>(NetDriver->OutBytesPerSecond));
+		JsonWriter->WriteValue(TEXT("inBytesWindow"), static_cast<int64>(InTotalBytes - LastInTotalBytes));
+		JsonWriter->WriteValue(TEXT("outBytesWindow"), static_cast<int64>(OutTotalBytes - LastOutTotalBytes));
+
+		LastInTotalBytes = InTotalBytes;
+		LastOutTotalBytes = OutTotalBytes;
+	}
+	JsonWriter->WriteObjectEnd();
+
+	// Start a new window
+	WindowFrameTimes.Reset();
+	WindowGameThreadTimes.Reset();
+	LastMetricsTime = TimeNow;
+}
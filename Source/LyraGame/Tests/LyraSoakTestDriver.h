@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Object.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "LyraSoakTestDriver.generated.h"
+
+class AAIController;
+class UWorld;
+
+/** Parameters for a soak run, usually parsed from the body of the /soak/start request */
+struct LYRAGAME_API FLyraSoakTestParams
+{
+	/** How many bots to add on top of the ones the experience already spawned */
+	int32 NumBotsToAdd = 0;
+
+	/** If true, bots periodically activate their weapon fire ability */
+	bool bScriptedFire = true;
+
+	/** If true, bots stop running their behavior tree and instead move to random reachable points */
+	bool bScriptedMovement = true;
+
+	/** Seconds between fire attempts for each bot */
+	float FireIntervalSeconds = 0.5f;
+
+	/** Seconds between new move requests for each bot */
+	float MoveIntervalSeconds = 4.0f;
+
+	/** Radius around the bot used to pick the next move destination */
+	float MoveRadius = 3000.0f;
+
+	/** The soak stops on its own after this many seconds (0 = run until stopped) */
+	float DurationSeconds = 0.0f;
+
+	void ReadFromJson(const FJsonObject& JsonObject);
+};
+
+/**
+ * ULyraSoakTestDriver
+ *
+ *	Drives a long running load test on a server: spawns bots through the ULyraBotCreationComponent,
+ *	runs scripted fire/move loops on every bot and samples frame, memory, object and network metrics
+ *	so they can be streamed out through the external RPC registry.
+ */
+UCLASS()
+class LYRAGAME_API ULyraSoakTestDriver : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Starts (or restarts) a soak run in the specified world */
+	bool StartSoak(UWorld* InWorld, const FLyraSoakTestParams& InParams, FString& OutError);
+
+	/** Stops the current soak run, bots that were added stay in the match */
+	void StopSoak();
+
+	bool IsSoakRunning() const { return TickHandle.IsValid(); }
+
+	/**
+	 * Writes the metrics gathered since the previous call, plus the totals of the current run.
+	 * Frame time percentiles are computed over the window since the previous call so a polling client gets a time series.
+	 */
+	void WriteMetrics(const TSharedRef<TJsonWriter<>>& JsonWriter);
+
+	//~UObject interface
+	virtual void BeginDestroy() override;
+	//~End of UObject interface
+
+private:
+	bool HandleTick(float DeltaTime);
+
+	void UpdateBot(AAIController* BotController, double TimeNow);
+
+	static float ComputePercentile(TArray<float>& SortedScratch, const TArray<float>& Samples, float Percentile);
+
+private:
+	struct FSoakBotState
+	{
+		double NextMoveTime = 0.0;
+		double NextFireTime = 0.0;
+		bool bLogicStopped = false;
+	};
+
+	FLyraSoakTestParams Params;
+
+	TWeakObjectPtr<UWorld> SoakWorld;
+
+	TMap<TWeakObjectPtr<AAIController>, FSoakBotState> BotStates;
+
+	FTSTicker::FDelegateHandle TickHandle;
+
+	// Frame samples (in milliseconds) since the last metrics request
+	TArray<float> WindowFrameTimes;
+	TArray<float> WindowGameThreadTimes;
+
+	// Scratch space for sorting samples when computing percentiles
+	TArray<float> SortScratch;
+
+	double SoakStartTime = 0.0;
+	double LastMetricsTime = 0.0;
+	int64 TotalFrames = 0;
+	float WorstFrameTimeMs = 0.0f;
+
+	// Network totals at the last metrics request, used to report per-window deltas
+	uint64 LastInTotalBytes = 0;
+	uint64 LastOutTotalBytes = 0;
+
+	// Highest UObject count observed during the run
+	int32 PeakObjectCount = 0;
+
+	// Caps the per-window sample buffers if nobody polls for a long time
+	static constexpr int32 MaxWindowSamples = 60 * 60 * 10;
+};
@@ -6,6 +6,7 @@
 #include "IActorIndicatorWidget.h"
 #include "Layout/ArrangedChildren.h"
 #include "LyraIndicatorManagerComponent.h"
+#include "Player/LyraLocalPlayer.h"
 #include "SceneView.h"
 #include "UI/IndicatorSystem/IndicatorDescriptor.h"
 #include "Widgets/Layout/SBox.h"
@@ -195,8 +196,20 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 	{
 		const FGeometry PaintGeometry = OptionalPaintGeometry.GetValue();
 
-		FSceneViewProjectionData ProjectionData;
-		if (LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, /*out*/ ProjectionData))
+		// Use the view taken after the camera update instead of building the projection again
+		const ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(LocalPlayer);
+		const FLyraLocalPlayerViewSnapshot* ViewSnapshot = LyraLocalPlayer ? &LyraLocalPlayer->GetViewSnapshot() : nullptr;
+		if (ViewSnapshot && !ViewSnapshot->IsCurrent())
+		{
+			// Not taken by the latest camera update, e.g. the player isn't driven by a Lyra player controller
+			ViewSnapshot = nullptr;
+		}
+
+		FSceneViewProjectionData FallbackProjectionData;
+		const bool bHasProjectionData = ViewSnapshot ? ViewSnapshot->bIsValid : LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, /*out*/ FallbackProjectionData);
+		const FSceneViewProjectionData& ProjectionData = ViewSnapshot ? ViewSnapshot->ProjectionData : FallbackProjectionData;
+
+		if (bHasProjectionData)
 		{
 			SetShowAnyIndicators(true);
 
@@ -27,8 +27,10 @@ void ULyraReticleWidgetBase::InitializeFromWeapon(ULyraWeaponInstance* InWeapon)
 
 float ULyraReticleWidgetBase::ComputeSpreadAngle() const
 {
-	if (const ULyraRangedWeaponInstance* RangedWeapon = Cast<const ULyraRangedWeaponInstance>(WeaponInstance))
+	if (ULyraRangedWeaponInstance* RangedWeapon = Cast<ULyraRangedWeaponInstance>(WeaponInstance))
 	{
+		RangedWeapon->UpdateSpreadMultipliers();
+
 		const float BaseSpreadAngle = RangedWeapon->GetCalculatedSpreadAngle();
 		const float SpreadAngleMultiplier = RangedWeapon->GetCalculatedSpreadAngleMultiplier();
 		const float ActualSpreadAngle = BaseSpreadAngle * SpreadAngleMultiplier;
@@ -43,8 +45,9 @@ float ULyraReticleWidgetBase::ComputeSpreadAngle() const
 
 bool ULyraReticleWidgetBase::HasFirstShotAccuracy() const
 {
-	if (const ULyraRangedWeaponInstance* RangedWeapon = Cast<const ULyraRangedWeaponInstance>(WeaponInstance))
+	if (ULyraRangedWeaponInstance* RangedWeapon = Cast<ULyraRangedWeaponInstance>(WeaponInstance))
 	{
+		RangedWeapon->UpdateSpreadMultipliers();
 		return RangedWeapon->HasFirstShotAccuracy();
 	}
 	else
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraCurveLookupTable.h"
+
+#include "Curves/RichCurve.h"
+
+namespace LyraCurveLookupTable
+{
+	static bool IsClampedExtrapolation(ERichCurveExtrapolation Extrapolation)
+	{
+		return (Extrapolation == RCCE_Constant) || (Extrapolation == RCCE_None);
+	}
+
+	static bool CanBake(const FRichCurve& Curve)
+	{
+		// Outside the keys the samples are clamped, so only curves which hold their end values can be baked
+		if (!IsClampedExtrapolation(Curve.PreInfinityExtrap) || !IsClampedExtrapolation(Curve.PostInfinityExtrap))
+		{
+			return false;
+		}
+
+		// Steps can't be linearly interpolated without smearing them across a sample
+		for (const FRichCurveKey& Key : Curve.GetConstRefOfKeys())
+		{
+			if (Key.InterpMode == RCIM_Constant)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+void FLyraCurveLookupTable::Bake(const FRichCurve& Curve)
+{
+	Reset();
+
+	if (!LyraCurveLookupTable::CanBake(Curve))
+	{
+		return;
+	}
+
+	float MaxTime;
+	Curve.GetTimeRange(/*out*/ MinTime, /*out*/ MaxTime);
+
+	// Curves without keys or with a single key are flat, two equal samples are enough
+	const int32 NumCurveSamples = (MaxTime > MinTime) ? NumSamples : 2;
+	const float SampleSpacing = (MaxTime - MinTime) / (NumCurveSamples - 1);
+	InvSampleSpacing = (SampleSpacing > 0.0f) ? (1.0f / SampleSpacing) : 0.0f;
+
+	Samples.SetNumUninitialized(NumCurveSamples);
+	for (int32 SampleIndex = 0; SampleIndex < NumCurveSamples; ++SampleIndex)
+	{
+		// The last sample is taken at MaxTime exactly so the end key isn't lost to rounding
+		const float SampleTime = (SampleIndex == NumCurveSamples - 1) ? MaxTime : (MinTime + (SampleIndex * SampleSpacing));
+		Samples[SampleIndex] = Curve.Eval(SampleTime);
+	}
+}
+
+void FLyraCurveLookupTable::Reset()
+{
+	Samples.Reset();
+	MinTime = 0.0f;
+	InvSampleSpacing = 0.0f;
+}
+
+float FLyraCurveLookupTable::Eval(float InTime, const FRichCurve& FallbackCurve) const
+{
+	if (!IsBaked())
+	{
+		return FallbackCurve.Eval(InTime);
+	}
+
+	const int32 LastIndex = Samples.Num() - 1;
+	const float Position = FMath::Clamp((InTime - MinTime) * InvSampleSpacing, 0.0f, static_cast<float>(LastIndex));
+	const int32 Index = FMath::Min(FMath::FloorToInt32(Position), LastIndex - 1);
+
+	return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - Index);
+}
@@ -0,0 +1,47 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+
+struct FRichCurve;
+
+/**
+ * FLyraCurveLookupTable
+ *
+ * A float curve baked into uniformly spaced samples, evaluated with linear interpolation
+ * instead of searching the keys of the rich curve every time.
+ *
+ * Curves the samples can't reproduce (stepped keys, or extrapolation other than constant)
+ * are not baked, and Eval falls back to the rich curve they were baked from.
+ */
+struct LYRAGAME_API FLyraCurveLookupTable
+{
+public:
+	// Number of samples a curve is baked into
+	static constexpr int32 NumSamples = 256;
+
+	// Bakes the curve, replacing any previous samples
+	void Bake(const FRichCurve& Curve);
+
+	// Clears the samples, Eval will use the fallback curve
+	void Reset();
+
+	// Returns true if the curve was baked into samples
+	bool IsBaked() const
+	{
+		return Samples.Num() > 0;
+	}
+
+	// Returns the value at InTime, FallbackCurve must be the curve that was last baked
+	float Eval(float InTime, const FRichCurve& FallbackCurve) const;
+
+private:
+	TArray<float> Samples;
+
+	// Time of the first sample
+	float MinTime = 0.0f;
+
+	// Reciprocal of the time between two samples (0 for flat curves)
+	float InvSampleSpacing = 0.0f;
+};
@@ -2,6 +2,7 @@
 
 #include "LyraGameplayAbility_RangedWeapon.h"
 #include "Weapons/LyraRangedWeaponInstance.h"
+#include "Async/ParallelFor.h"
 #include "Physics/LyraCollisionChannels.h"
 #include "LyraLogChannels.h"
 #include "AIController.h"
@@ -35,6 +36,13 @@ namespace LyraConsoleVariables
 		DrawBulletHitRadius,
 		TEXT("When bullet hit debug drawing is enabled (see DrawBulletHitDuration), how big should the hit radius be? (in uu)"),
 		ECVF_Default);
+
+	static int32 MinBulletsForParallelTraces = 4;
+	static FAutoConsoleVariableRef CVarMinBulletsForParallelTraces(
+		TEXT("lyra.Weapon.MinBulletsForParallelTraces"),
+		MinBulletsForParallelTraces,
+		TEXT("Cartridges with at least this many bullets trace them in parallel on worker threads (0 always traces on the game thread)"),
+		ECVF_Default);
 }
 
 // Weapon fire will be blocked/canceled if the player has this tag
@@ -140,16 +148,29 @@ ECollisionChannel ULyraGameplayAbility_RangedWeapon::DetermineTraceChannel(FColl
 	return Lyra_TraceChannel_Weapon;
 }
 
-FHitResult ULyraGameplayAbility_RangedWeapon::WeaponTrace(const FVector& StartTrace, const FVector& EndTrace, float SweepRadius, bool bIsSimulated, OUT TArray<FHitResult>& OutHitResults) const
+ECollisionChannel ULyraGameplayAbility_RangedWeapon::MakeWeaponTraceParams(bool bIsSimulated, OUT FCollisionQueryParams& TraceParams) const
 {
-	TArray<FHitResult> HitResults;
-	
-	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(WeaponTrace), /*bTraceComplex=*/ true, /*IgnoreActor=*/ GetAvatarActorFromActorInfo());
+	TraceParams = FCollisionQueryParams(SCENE_QUERY_STAT(WeaponTrace), /*bTraceComplex=*/ true, /*IgnoreActor=*/ GetAvatarActorFromActorInfo());
 	TraceParams.bReturnPhysicalMaterial = true;
 	AddAdditionalTraceIgnoreActors(TraceParams);
 	//TraceParams.bDebugQuery = true;
 
-	const ECollisionChannel TraceChannel = DetermineTraceChannel(TraceParams, bIsSimulated);
+	return DetermineTraceChannel(TraceParams, bIsSimulated);
+}
+
+FHitResult ULyraGameplayAbility_RangedWeapon::WeaponTrace(const FVector& StartTrace, const FVector& EndTrace, float SweepRadius, bool bIsSimulated, OUT TArray<FHitResult>& OutHitResults) const
+{
+	FCollisionQueryParams TraceParams;
+	const ECollisionChannel TraceChannel = MakeWeaponTraceParams(bIsSimulated, /*out*/ TraceParams);
+
+	TArray<FHitResult> HitResults;
+	return WeaponTrace(StartTrace, EndTrace, SweepRadius, TraceChannel, TraceParams, /*out*/ HitResults, /*out*/ OutHitResults);
+}
+
+FHitResult ULyraGameplayAbility_RangedWeapon::WeaponTrace(const FVector& StartTrace, const FVector& EndTrace, float SweepRadius, ECollisionChannel TraceChannel, const FCollisionQueryParams& TraceParams, OUT TArray<FHitResult>& QueryHits, OUT TArray<FHitResult>& OutHitResults) const
+{
+	TArray<FHitResult>& HitResults = QueryHits;
+	HitResults.Reset();
 
 	if (SweepRadius > 0.0f)
 	{
@@ -299,13 +320,30 @@ FHitResult ULyraGameplayAbility_RangedWeapon::DoSingleBulletTrace(const FVector&
 	}
 #endif // ENABLE_DRAW_DEBUG
 
+	FCollisionQueryParams TraceParams;
+	const ECollisionChannel TraceChannel = MakeWeaponTraceParams(bIsSimulated, /*out*/ TraceParams);
+
+	FBulletTraceScratch Scratch;
+	Scratch.EndTrace = EndTrace;
+	Scratch.Hits = MoveTemp(OutHits);
+	DoSingleBulletTrace(StartTrace, SweepRadius, TraceChannel, TraceParams, Scratch);
+	OutHits = MoveTemp(Scratch.Hits);
+
+	return Scratch.Impact;
+}
+
+void ULyraGameplayAbility_RangedWeapon::DoSingleBulletTrace(const FVector& StartTrace, float SweepRadius, ECollisionChannel TraceChannel, const FCollisionQueryParams& TraceParams, FBulletTraceScratch& Scratch) const
+{
+	const FVector& EndTrace = Scratch.EndTrace;
+	TArray<FHitResult>& OutHits = Scratch.Hits;
+
 	FHitResult Impact;
 
 	// Trace and process instant hit if something was hit
 	// First trace without using sweep radius
 	if (FindFirstPawnHitResult(OutHits) == INDEX_NONE)
 	{
-		Impact = WeaponTrace(StartTrace, EndTrace, /*SweepRadius=*/ 0.0f, bIsSimulated, /*out*/ OutHits);
+		Impact = WeaponTrace(StartTrace, EndTrace, /*SweepRadius=*/ 0.0f, TraceChannel, TraceParams, /*out*/ Scratch.QueryHits, /*out*/ OutHits);
 	}
 
 	if (FindFirstPawnHitResult(OutHits) == INDEX_NONE)
@@ -313,8 +351,9 @@ FHitResult ULyraGameplayAbility_RangedWeapon::DoSingleBulletTrace(const FVector&
 		// If this weapon didn't hit anything with a line trace and supports a sweep radius, try that
 		if (SweepRadius > 0.0f)
 		{
-			TArray<FHitResult> SweepHits;
-			Impact = WeaponTrace(StartTrace, EndTrace, SweepRadius, bIsSimulated, /*out*/ SweepHits);
+			TArray<FHitResult>& SweepHits = Scratch.SweepHits;
+			SweepHits.Reset();
+			Impact = WeaponTrace(StartTrace, EndTrace, SweepRadius, TraceChannel, TraceParams, /*out*/ Scratch.QueryHits, /*out*/ SweepHits);
 
 			// If the trace with sweep radius enabled hit a pawn, check if we should use its hit results
 			const int32 FirstPawnIdx = FindFirstPawnHitResult(SweepHits);
@@ -346,7 +385,7 @@ FHitResult ULyraGameplayAbility_RangedWeapon::DoSingleBulletTrace(const FVector&
 		}
 	}
 
-	return Impact;
+	Scratch.Impact = Impact;
 }
 
 void ULyraGameplayAbility_RangedWeapon::PerformLocalTargeting(OUT TArray<FHitResult>& OutHits)
@@ -385,23 +424,59 @@ void ULyraGameplayAbility_RangedWeapon::TraceBulletsInCartridge(const FRangedWea
 	check(WeaponData);
 
 	const int32 BulletsPerCartridge = WeaponData->GetBulletsPerCartridge();
+	const float SweepRadius = WeaponData->GetBulletTraceSweepRadius();
 
+	// The spread doesn't change between the bullets of a cartridge
+	// The weapon may not have ticked since the pawn started moving or jumping, so catch the multipliers up first
+	WeaponData->UpdateSpreadMultipliers();
+	const float BaseSpreadAngle = WeaponData->GetCalculatedSpreadAngle();
+	const float SpreadAngleMultiplier = WeaponData->GetCalculatedSpreadAngleMultiplier();
+	const float ActualSpreadAngle = BaseSpreadAngle * SpreadAngleMultiplier;
+
+	const float HalfSpreadAngleInRadians = FMath::DegreesToRadians(ActualSpreadAngle * 0.5f);
+
+	// The ignored actors and channel are the same for every trace of the cartridge
+	FCollisionQueryParams TraceParams;
+	const ECollisionChannel TraceChannel = MakeWeaponTraceParams(/*bIsSimulated=*/ false, /*out*/ TraceParams);
+
+	if (BulletTraceScratch.Num() < BulletsPerCartridge)
+	{
+		BulletTraceScratch.SetNum(BulletsPerCartridge);
+	}
+
+	// Pick the bullet directions up front, in order, so the random stream is consumed the same way as tracing one by one
 	for (int32 BulletIndex = 0; BulletIndex < BulletsPerCartridge; ++BulletIndex)
 	{
-		const float BaseSpreadAngle = WeaponData->GetCalculatedSpreadAngle();
-		const float SpreadAngleMultiplier = WeaponData->GetCalculatedSpreadAngleMultiplier();
-		const float ActualSpreadAngle = BaseSpreadAngle * SpreadAngleMultiplier;
+		const FVector BulletDir = VRandConeNormalDistribution(InputData.AimDir, HalfSpreadAngleInRadians, WeaponData->GetSpreadExponent());
 
-		const float HalfSpreadAngleInRadians = FMath::DegreesToRadians(ActualSpreadAngle * 0.5f);
+		FBulletTraceScratch& Scratch = BulletTraceScratch[BulletIndex];
+		Scratch.EndTrace = InputData.StartTrace + (BulletDir * WeaponData->GetMaxDamageRange());
+		Scratch.Hits.Reset();
 
-		const FVector BulletDir = VRandConeNormalDistribution(InputData.AimDir, HalfSpreadAngleInRadians, WeaponData->GetSpreadExponent());
+#if ENABLE_DRAW_DEBUG
+		if (LyraConsoleVariables::DrawBulletTracesDuration > 0.0f)
+		{
+			static float DebugThickness = 1.0f;
+			DrawDebugLine(GetWorld(), InputData.StartTrace, Scratch.EndTrace, FColor::Red, false, LyraConsoleVariables::DrawBulletTracesDuration, 0, DebugThickness);
+		}
+#endif // ENABLE_DRAW_DEBUG
+	}
 
-		const FVector EndTrace = InputData.StartTrace + (BulletDir * WeaponData->GetMaxDamageRange());
-		FVector HitLocation = EndTrace;
+	// Scene queries only read the physics scene, so the bullets of a shotgun blast can be traced side by side
+	const bool bTraceInParallel = (LyraConsoleVariables::MinBulletsForParallelTraces > 0) && (BulletsPerCartridge >= LyraConsoleVariables::MinBulletsForParallelTraces);
+	ParallelFor(BulletsPerCartridge, [&](int32 BulletIndex)
+	{
+		DoSingleBulletTrace(InputData.StartTrace, SweepRadius, TraceChannel, TraceParams, BulletTraceScratch[BulletIndex]);
+	}, /*bForceSingleThread=*/ !bTraceInParallel);
 
-		TArray<FHitResult> AllImpacts;
+	for (int32 BulletIndex = 0; BulletIndex < BulletsPerCartridge; ++BulletIndex)
+	{
+		FBulletTraceScratch& Scratch = BulletTraceScratch[BulletIndex];
+		const FVector& EndTrace = Scratch.EndTrace;
+		FHitResult& Impact = Scratch.Impact;
+		const TArray<FHitResult>& AllImpacts = Scratch.Hits;
 
-		FHitResult Impact = DoSingleBulletTrace(InputData.StartTrace, EndTrace, WeaponData->GetBulletTraceSweepRadius(), /*bIsSimulated=*/ false, /*out*/ AllImpacts);
+		FVector HitLocation = EndTrace;
 
 		const AActor* HitActor = Impact.GetActor();
 
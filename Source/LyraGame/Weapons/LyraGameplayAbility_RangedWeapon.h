@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Engine/HitResult.h"
 #include "Equipment/LyraGameplayAbility_FromEquipment.h"
 
 #include "LyraGameplayAbility_RangedWeapon.generated.h"
@@ -87,15 +88,43 @@ protected:
 		}
 	};
 
+	// Storage for the traces of a single bullet, kept between cartridges so the hit arrays don't need to be reallocated
+	struct FBulletTraceScratch
+	{
+		// End of the trace after applying spread
+		FVector EndTrace = FVector::ZeroVector;
+
+		// The impact returned by DoSingleBulletTrace
+		FHitResult Impact;
+
+		// The filtered hits of the bullet
+		TArray<FHitResult> Hits;
+
+		// The filtered hits of the sweep, if the line trace didn't hit a pawn
+		TArray<FHitResult> SweepHits;
+
+		// The unfiltered results of the last query
+		TArray<FHitResult> QueryHits;
+	};
+
 protected:
 	static int32 FindFirstPawnHitResult(const TArray<FHitResult>& HitResults);
 
 	// Does a single weapon trace, either sweeping or ray depending on if SweepRadius is above zero
 	FHitResult WeaponTrace(const FVector& StartTrace, const FVector& EndTrace, float SweepRadius, bool bIsSimulated, OUT TArray<FHitResult>& OutHitResults) const;
 
+	// WeaponTrace with query params that were already set up, can be called from worker threads
+	FHitResult WeaponTrace(const FVector& StartTrace, const FVector& EndTrace, float SweepRadius, ECollisionChannel TraceChannel, const FCollisionQueryParams& TraceParams, OUT TArray<FHitResult>& QueryHits, OUT TArray<FHitResult>& OutHitResults) const;
+
 	// Wrapper around WeaponTrace to handle trying to do a ray trace before falling back to a sweep trace if there were no hits and SweepRadius is above zero 
 	FHitResult DoSingleBulletTrace(const FVector& StartTrace, const FVector& EndTrace, float SweepRadius, bool bIsSimulated, OUT TArray<FHitResult>& OutHits) const;
 
+	// DoSingleBulletTrace with query params that were already set up, results are written to the scratch, can be called from worker threads
+	void DoSingleBulletTrace(const FVector& StartTrace, float SweepRadius, ECollisionChannel TraceChannel, const FCollisionQueryParams& TraceParams, FBulletTraceScratch& Scratch) const;
+
+	// Sets up the query params and trace channel shared by all the weapon traces of a shot
+	ECollisionChannel MakeWeaponTraceParams(bool bIsSimulated, OUT FCollisionQueryParams& TraceParams) const;
+
 	// Traces all of the bullets in a single cartridge
 	void TraceBulletsInCartridge(const FRangedWeaponFiringInput& InputData, OUT TArray<FHitResult>& OutHits);
 
@@ -120,4 +149,7 @@ protected:
 
 private:
 	FDelegateHandle OnTargetDataReadyCallbackDelegateHandle;
+
+	// One entry per bullet of the last traced cartridge, see TraceBulletsInCartridge
+	TArray<FBulletTraceScratch> BulletTraceScratch;
 };
@@ -12,6 +12,23 @@
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Weapon_SteadyAimingCamera, "Lyra.Weapon.SteadyAimingCamera");
 
+namespace LyraConsoleVariables
+{
+	static float HeatCoolDownStep = 1.0f / 60.0f;
+	static FAutoConsoleVariableRef CVarHeatCoolDownStep(
+		TEXT("lyra.Weapon.HeatCoolDownStep"),
+		HeatCoolDownStep,
+		TEXT("Step size (in seconds) used to integrate the heat cooldown for weapons whose cooldown rate depends on the heat"),
+		ECVF_Default);
+
+	static int32 HeatCoolDownMaxSteps = 120;
+	static FAutoConsoleVariableRef CVarHeatCoolDownMaxSteps(
+		TEXT("lyra.Weapon.HeatCoolDownMaxSteps"),
+		HeatCoolDownMaxSteps,
+		TEXT("Maximum number of steps used to integrate the heat cooldown, longer cooldowns use larger steps"),
+		ECVF_Default);
+}
+
 ULyraRangedWeaponInstance::ULyraRangedWeaponInstance(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -19,10 +36,26 @@ ULyraRangedWeaponInstance::ULyraRangedWeaponInstance(const FObjectInitializer& O
 	HeatToCoolDownPerSecondCurve.EditorCurveData.AddKey(0.0f, 2.0f);
 }
 
+void ULyraRangedWeaponInstance::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// The curves are baked once per class on its defaults, instances created at runtime share those tables
+	if (HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		BakeCurves();
+	}
+}
+
 void ULyraRangedWeaponInstance::PostLoad()
 {
 	Super::PostLoad();
 
+	if (HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		BakeCurves();
+	}
+
 #if WITH_EDITOR
 	UpdateDebugVisualization();
 #endif
@@ -32,15 +65,28 @@ void ULyraRangedWeaponInstance::PostLoad()
 void ULyraRangedWeaponInstance::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// An instance edited directly no longer matches its class defaults, so it needs tables of its own
+	BakeCurves();
+	bHasOwnBakedCurves = !HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject);
+
 	UpdateDebugVisualization();
 }
 
+void ULyraRangedWeaponInstance::PostCDOCompiled(const FPostCDOCompiledContext& Context)
+{
+	Super::PostCDOCompiled(Context);
+
+	// A recompiled blueprint gets a new class defaults object, which receives its curves after PostInitProperties and is never loaded
+	BakeCurves();
+}
+
 void ULyraRangedWeaponInstance::UpdateDebugVisualization()
 {
 	ComputeHeatRange(/*out*/ Debug_MinHeat, /*out*/ Debug_MaxHeat);
 	ComputeSpreadRange(/*out*/ Debug_MinSpreadAngle, /*out*/ Debug_MaxSpreadAngle);
-	Debug_CurrentHeat = CurrentHeat;
-	Debug_CurrentSpreadAngle = CurrentSpreadAngle;
+	Debug_CurrentHeat = GetWorld() ? ComputeHeatAtTime(GetWorld()->GetTimeSeconds()) : CurrentHeat;
+	Debug_CurrentSpreadAngle = GetBakedCurves()->HeatToSpreadTable.Eval(Debug_CurrentHeat, *HeatToSpreadCurve.GetRichCurveConst());
 	Debug_CurrentSpreadAngleMultiplier = CurrentSpreadAngleMultiplier;
 }
 #endif
@@ -54,12 +100,13 @@ void ULyraRangedWeaponInstance::OnEquipped()
 	float MaxHeatRange;
 	ComputeHeatRange(/*out*/ MinHeatRange, /*out*/ MaxHeatRange);
 	CurrentHeat = (MinHeatRange + MaxHeatRange) * 0.5f;
-
-	// Derive spread
-	CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurveConst()->Eval(CurrentHeat);
+	HeatUpdateTime = GetWorld()->GetTimeSeconds();
 
 	// Default the multipliers to 1x
 	CurrentSpreadAngleMultiplier = 1.0f;
+	bMultipliersAtMin = false;
+	bMultipliersSettled = false;
+	MultiplierUpdateTime = GetWorld()->GetTimeSeconds();
 	StandingStillMultiplier = 1.0f;
 	JumpFallMultiplier = 1.0f;
 	CrouchingMultiplier = 1.0f;
@@ -70,22 +117,130 @@ void ULyraRangedWeaponInstance::OnUnequipped()
 	Super::OnUnequipped();
 }
 
-void ULyraRangedWeaponInstance::Tick(float DeltaSeconds)
+bool ULyraRangedWeaponInstance::Tick(float DeltaSeconds)
 {
 	APawn* Pawn = GetPawn();
 	check(Pawn != nullptr);
 	
-	const bool bMinSpread = UpdateSpread(DeltaSeconds);
-	const bool bMinMultipliers = UpdateMultipliers(DeltaSeconds);
-
-	bHasFirstShotAccuracy = bAllowFirstShotAccuracy && bMinMultipliers && bMinSpread;
+	// The heat isn't ticked, it's cooled down when it's queried
+	UpdateSpreadMultipliers();
 
 #if WITH_EDITOR
 	UpdateDebugVisualization();
 #endif
+
+	return !bMultipliersSettled;
+}
+
+void ULyraRangedWeaponInstance::UpdateSpreadMultipliers()
+{
+	const UWorld* World = GetWorld();
+	if ((World == nullptr) || (GetPawn() == nullptr))
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	if (Now <= MultiplierUpdateTime)
+	{
+		// Already up to date this frame (e.g., ticked before firing)
+		return;
+	}
+
+	// Settled multipliers don't move until the pawn's state changes, and that change can't be told apart from one made this frame,
+	// so only blend by one frame rather than the whole time since the last (slow) update
+	const float DeltaSeconds = FMath::Min(static_cast<float>(Now - MultiplierUpdateTime), World->GetDeltaSeconds());
+	MultiplierUpdateTime = Now;
+
+	bool bSettled = true;
+	bMultipliersAtMin = UpdateMultipliers(DeltaSeconds, /*out*/ bSettled);
+	bMultipliersSettled = bSettled;
+}
+
+float ULyraRangedWeaponInstance::GetCalculatedSpreadAngle() const
+{
+	const UWorld* World = GetWorld();
+	const float Heat = World ? ComputeHeatAtTime(World->GetTimeSeconds()) : CurrentHeat;
+	return GetBakedCurves()->HeatToSpreadTable.Eval(Heat, *HeatToSpreadCurve.GetRichCurveConst());
+}
+
+bool ULyraRangedWeaponInstance::HasFirstShotAccuracy() const
+{
+	if (!bAllowFirstShotAccuracy || !bMultipliersAtMin)
+	{
+		return false;
+	}
+
+	float MinSpread;
+	float MaxSpread;
+	ComputeSpreadRange(/*out*/ MinSpread, /*out*/ MaxSpread);
+
+	return FMath::IsNearlyEqual(GetCalculatedSpreadAngle(), MinSpread, KINDA_SMALL_NUMBER);
+}
+
+void ULyraRangedWeaponInstance::BakeCurves()
+{
+	HeatToSpreadTable.Bake(*HeatToSpreadCurve.GetRichCurveConst());
+	HeatToHeatPerShotTable.Bake(*HeatToHeatPerShotCurve.GetRichCurveConst());
+	HeatToCoolDownPerSecondTable.Bake(*HeatToCoolDownPerSecondCurve.GetRichCurveConst());
+	DistanceDamageFalloffTable.Bake(*DistanceDamageFalloff.GetRichCurveConst());
+
+	float MinCoolDownRate;
+	float MaxCoolDownRate;
+	HeatToCoolDownPerSecondCurve.GetRichCurveConst()->GetValueRange(/*out*/ MinCoolDownRate, /*out*/ MaxCoolDownRate);
+	bConstantCoolDownRate = (MinCoolDownRate == MaxCoolDownRate);
+}
+
+const ULyraRangedWeaponInstance* ULyraRangedWeaponInstance::GetBakedCurves() const
+{
+	return bHasOwnBakedCurves ? this : GetClass()->GetDefaultObject<ULyraRangedWeaponInstance>();
+}
+
+float ULyraRangedWeaponInstance::ComputeHeatAtTime(double WorldTime) const
+{
+	// Cooling starts once the recovery delay after the last shot has passed
+	const double CoolDownStartTime = FMath::Max(HeatUpdateTime, LastFireTime + SpreadRecoveryCooldownDelay);
+	const float CoolDownSeconds = static_cast<float>(WorldTime - CoolDownStartTime);
+	if (CoolDownSeconds <= 0.0f)
+	{
+		return CurrentHeat;
+	}
+
+	const ULyraRangedWeaponInstance* BakedCurves = GetBakedCurves();
+	const FRichCurve* CoolDownCurve = HeatToCoolDownPerSecondCurve.GetRichCurveConst();
+	if (BakedCurves->bConstantCoolDownRate)
+	{
+		return ClampHeat(CurrentHeat - (BakedCurves->HeatToCoolDownPerSecondTable.Eval(CurrentHeat, *CoolDownCurve) * CoolDownSeconds));
+	}
+
+	// The rate depends on the heat, step through the cooldown like ticking every frame would have
+	float MinHeat;
+	float MaxHeat;
+	ComputeHeatRange(/*out*/ MinHeat, /*out*/ MaxHeat);
+
+	// The heat is queried every shot and the cooldown always starts from HeatUpdateTime, so long cooldowns
+	// are spread over a bounded number of steps instead of growing the cost of every query
+	const float StepSeconds = FMath::Max(LyraConsoleVariables::HeatCoolDownStep, UE_KINDA_SMALL_NUMBER);
+	const float MaxSteps = static_cast<float>(FMath::Max(LyraConsoleVariables::HeatCoolDownMaxSteps, 1));
+	const int32 NumSteps = FMath::Max(FMath::CeilToInt32(FMath::Min(CoolDownSeconds / StepSeconds, MaxSteps)), 1);
+	const float DeltaSeconds = CoolDownSeconds / NumSteps;
+
+	float Heat = CurrentHeat;
+	for (int32 StepIndex = 0; (StepIndex < NumSteps) && (Heat > MinHeat); ++StepIndex)
+	{
+		const float NewHeat = FMath::Clamp(Heat - (BakedCurves->HeatToCoolDownPerSecondTable.Eval(Heat, *CoolDownCurve) * DeltaSeconds), MinHeat, MaxHeat);
+		if (NewHeat == Heat)
+		{
+			// No cooldown at this heat (or it's pushing against the max), the remaining steps wouldn't change anything
+			break;
+		}
+		Heat = NewHeat;
+	}
+
+	return Heat;
 }
 
-void ULyraRangedWeaponInstance::ComputeHeatRange(float& MinHeat, float& MaxHeat)
+void ULyraRangedWeaponInstance::ComputeHeatRange(float& MinHeat, float& MaxHeat) const
 {
 	float Min1;
 	float Max1;
@@ -103,20 +258,22 @@ void ULyraRangedWeaponInstance::ComputeHeatRange(float& MinHeat, float& MaxHeat)
 	MaxHeat = FMath::Max(FMath::Max(Max1, Max2), Max3);
 }
 
-void ULyraRangedWeaponInstance::ComputeSpreadRange(float& MinSpread, float& MaxSpread)
+void ULyraRangedWeaponInstance::ComputeSpreadRange(float& MinSpread, float& MaxSpread) const
 {
 	HeatToSpreadCurve.GetRichCurveConst()->GetValueRange(/*out*/ MinSpread, /*out*/ MaxSpread);
 }
 
 void ULyraRangedWeaponInstance::AddSpread()
 {
+	// Bring the heat up to date before adding to it
+	const double WorldTime = GetWorld()->GetTimeSeconds();
+	CurrentHeat = ComputeHeatAtTime(WorldTime);
+	HeatUpdateTime = WorldTime;
+
 	// Sample the heat up curve
-	const float HeatPerShot = HeatToHeatPerShotCurve.GetRichCurveConst()->Eval(CurrentHeat);
+	const float HeatPerShot = GetBakedCurves()->HeatToHeatPerShotTable.Eval(CurrentHeat, *HeatToHeatPerShotCurve.GetRichCurveConst());
 	CurrentHeat = ClampHeat(CurrentHeat + HeatPerShot);
 
-	// Map the heat to the spread angle
-	CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurveConst()->Eval(CurrentHeat);
-
 #if WITH_EDITOR
 	UpdateDebugVisualization();
 #endif
@@ -125,7 +282,7 @@ void ULyraRangedWeaponInstance::AddSpread()
 float ULyraRangedWeaponInstance::GetDistanceAttenuation(float Distance, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags) const
 {
 	const FRichCurve* Curve = DistanceDamageFalloff.GetRichCurveConst();
-	return Curve->HasAnyData() ? Curve->Eval(Distance) : 1.0f;
+	return Curve->HasAnyData() ? GetBakedCurves()->DistanceDamageFalloffTable.Eval(Distance, *Curve) : 1.0f;
 }
 
 float ULyraRangedWeaponInstance::GetPhysicalMaterialAttenuation(const UPhysicalMaterial* PhysicalMaterial, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags) const
@@ -145,27 +302,10 @@ float ULyraRangedWeaponInstance::GetPhysicalMaterialAttenuation(const UPhysicalM
 	return CombinedMultiplier;
 }
 
-bool ULyraRangedWeaponInstance::UpdateSpread(float DeltaSeconds)
-{
-	const float TimeSinceFired = GetWorld()->TimeSince(LastFireTime);
-
-	if (TimeSinceFired > SpreadRecoveryCooldownDelay)
-	{
-		const float CooldownRate = HeatToCoolDownPerSecondCurve.GetRichCurveConst()->Eval(CurrentHeat);
-		CurrentHeat = ClampHeat(CurrentHeat - (CooldownRate * DeltaSeconds));
-		CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurveConst()->Eval(CurrentHeat);
-	}
-	
-	float MinSpread;
-	float MaxSpread;
-	ComputeSpreadRange(/*out*/ MinSpread, /*out*/ MaxSpread);
-
-	return FMath::IsNearlyEqual(CurrentSpreadAngle, MinSpread, KINDA_SMALL_NUMBER);
-}
-
-bool ULyraRangedWeaponInstance::UpdateMultipliers(float DeltaSeconds)
+bool ULyraRangedWeaponInstance::UpdateMultipliers(float DeltaSeconds, bool& bOutSettled)
 {
 	const float MultiplierNearlyEqualThreshold = 0.05f;
+	const float MultiplierSettledThreshold = 0.001f;
 
 	APawn* Pawn = GetPawn();
 	check(Pawn != nullptr);
@@ -208,6 +348,12 @@ bool ULyraRangedWeaponInstance::UpdateMultipliers(float DeltaSeconds)
 		/*Alpha=*/ AimingAlpha);
 	const bool bAimingMultiplierAtTarget = FMath::IsNearlyEqual(AimingMultiplier, SpreadAngleMultiplier_Aiming, KINDA_SMALL_NUMBER);
 
+	// Once everything has reached its target nothing changes until the pawn's state does
+	bOutSettled = FMath::IsNearlyEqual(StandingStillMultiplier, MovementTargetValue, MultiplierSettledThreshold)
+		&& FMath::IsNearlyEqual(CrouchingMultiplier, CrouchingTargetValue, MultiplierSettledThreshold)
+		&& FMath::IsNearlyEqual(JumpFallMultiplier, JumpFallTargetValue, MultiplierSettledThreshold)
+		&& ((AimingAlpha <= 0.0f) || (AimingAlpha >= 1.0f));
+
 	// Combine all the multipliers
 	const float CombinedMultiplier = AimingMultiplier * StandingStillMultiplier * CrouchingMultiplier * JumpFallMultiplier;
 	CurrentSpreadAngleMultiplier = CombinedMultiplier;
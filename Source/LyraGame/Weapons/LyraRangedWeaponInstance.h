@@ -6,6 +6,7 @@
 
 #include "LyraWeaponInstance.h"
 #include "AbilitySystem/LyraAbilitySourceInterface.h"
+#include "Weapons/LyraCurveLookupTable.h"
 
 #include "LyraRangedWeaponInstance.generated.h"
 
@@ -24,10 +25,14 @@ class ULyraRangedWeaponInstance : public ULyraWeaponInstance, public ILyraAbilit
 public:
 	ULyraRangedWeaponInstance(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	//~UObject interface
+	virtual void PostInitProperties() override;
 	virtual void PostLoad() override;
+	//~End of UObject interface
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostCDOCompiled(const FPostCDOCompiledContext& Context) override;
 
 	void UpdateDebugVisualization();
 #endif
@@ -38,20 +43,14 @@ public:
 	}
 	
 	/** Returns the current spread angle (in degrees, diametrical) */
-	float GetCalculatedSpreadAngle() const
-	{
-		return CurrentSpreadAngle;
-	}
+	float GetCalculatedSpreadAngle() const;
 
 	float GetCalculatedSpreadAngleMultiplier() const
 	{
-		return bHasFirstShotAccuracy ? 0.0f : CurrentSpreadAngleMultiplier;
+		return HasFirstShotAccuracy() ? 0.0f : CurrentSpreadAngleMultiplier;
 	}
 
-	bool HasFirstShotAccuracy() const
-	{
-		return bHasFirstShotAccuracy;
-	}
+	bool HasFirstShotAccuracy() const;
 
 	float GetSpreadExponent() const
 	{
@@ -193,14 +192,33 @@ private:
 	// Time since this weapon was last fired (relative to world time)
 	double LastFireTime = 0.0;
 
-	// The current heat
+	// The heat as of HeatUpdateTime, the cooldown since then is applied when the heat is queried
 	float CurrentHeat = 0.0f;
 
-	// The current spread angle (in degrees, diametrical)
-	float CurrentSpreadAngle = 0.0f;
+	// World time CurrentHeat was last changed at
+	double HeatUpdateTime = 0.0;
+
+	// Is the cooldown rate the same for every heat value? Then the cooldown can be solved in one step (set by BakeCurves, read through GetBakedCurves)
+	bool bConstantCoolDownRate = true;
+
+	// The heat and damage falloff curves baked for evaluation on every shot (see BakeCurves)
+	// Only filled in on the class defaults, instances read them through GetBakedCurves
+	FLyraCurveLookupTable HeatToSpreadTable;
+	FLyraCurveLookupTable HeatToHeatPerShotTable;
+	FLyraCurveLookupTable HeatToCoolDownPerSecondTable;
+	FLyraCurveLookupTable DistanceDamageFalloffTable;
+
+	// Were the curves baked on this instance because it was edited to differ from its class defaults?
+	bool bHasOwnBakedCurves = false;
 
-	// Do we currently have first shot accuracy?
-	bool bHasFirstShotAccuracy = false;
+	// Are all the multipliers at their minimum (see UpdateMultipliers)?
+	bool bMultipliersAtMin = false;
+
+	// Have all the multipliers reached their targets as of MultiplierUpdateTime?
+	bool bMultipliersSettled = true;
+
+	// World time the multipliers were last updated at
+	double MultiplierUpdateTime = 0.0;
 
 	// The current *combined* spread angle multiplier
 	float CurrentSpreadAngleMultiplier = 1.0f;
@@ -215,7 +233,12 @@ private:
 	float CrouchingMultiplier = 1.0f;
 
 public:
-	void Tick(float DeltaSeconds);
+	// Updates the spread multipliers, returns true while they are still blending and need to be updated every frame
+	bool Tick(float DeltaSeconds);
+
+	// Brings the spread multipliers up to date with the pawn's current movement and stance, call before reading the spread
+	// The weapon only ticks slowly while they are settled, so a state change since the last tick wouldn't be reflected otherwise
+	void UpdateSpreadMultipliers();
 
 	//~ULyraEquipmentInstance interface
 	virtual void OnEquipped();
@@ -230,10 +253,19 @@ public:
 	//~End of ILyraAbilitySourceInterface interface
 
 private:
-	void ComputeSpreadRange(float& MinSpread, float& MaxSpread);
-	void ComputeHeatRange(float& MinHeat, float& MaxHeat);
+	void ComputeSpreadRange(float& MinSpread, float& MaxSpread) const;
+	void ComputeHeatRange(float& MinHeat, float& MaxHeat) const;
+
+	// Bakes the curves into lookup tables and caches what can be known about them up front
+	void BakeCurves();
 
-	inline float ClampHeat(float NewHeat)
+	// Returns the object holding the baked tables for this instance's curves, normally the class defaults
+	const ULyraRangedWeaponInstance* GetBakedCurves() const;
+
+	// Returns the heat at the given world time, after cooling down from CurrentHeat
+	float ComputeHeatAtTime(double WorldTime) const;
+
+	inline float ClampHeat(float NewHeat) const
 	{
 		float MinHeat;
 		float MaxHeat;
@@ -242,9 +274,7 @@ private:
 		return FMath::Clamp(NewHeat, MinHeat, MaxHeat);
 	}
 
-	// Updates the spread and returns true if the spread is at minimum
-	bool UpdateSpread(float DeltaSeconds);
-
 	// Updates the multipliers and returns true if they are at minimum
-	bool UpdateMultipliers(float DeltaSeconds);
+	// bOutSettled is set to false while any of the multipliers is still blending towards its target
+	bool UpdateMultipliers(float DeltaSeconds, bool& bOutSettled);
 };
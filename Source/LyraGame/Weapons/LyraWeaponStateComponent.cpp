@@ -16,6 +16,16 @@
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Gameplay_Zone, "Gameplay.Zone");
 
+namespace LyraConsoleVariables
+{
+	static float WeaponIdleTickInterval = 0.25f;
+	static FAutoConsoleVariableRef CVarWeaponIdleTickInterval(
+		TEXT("lyra.Weapon.IdleTickInterval"),
+		WeaponIdleTickInterval,
+		TEXT("Tick interval (in seconds) of the weapon state component while the current weapon's spread multipliers are settled (0 ticks every frame)"),
+		ECVF_Default);
+}
+
 ULyraWeaponStateComponent::ULyraWeaponStateComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -29,16 +39,22 @@ void ULyraWeaponStateComponent::TickComponent(float DeltaTime, enum ELevelTick T
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (APawn* Pawn = GetPawn<APawn>())
+	bool bNeedsUpdates = false;
+	APawn* Pawn = GetPawn<APawn>();
+	if (Pawn)
 	{
 		if (ULyraEquipmentManagerComponent* EquipmentManager = Pawn->FindComponentByClass<ULyraEquipmentManagerComponent>())
 		{
 			if (ULyraRangedWeaponInstance* CurrentWeapon = Cast<ULyraRangedWeaponInstance>(EquipmentManager->GetFirstInstanceOfType(ULyraRangedWeaponInstance::StaticClass())))
 			{
-				CurrentWeapon->Tick(DeltaTime);
+				bNeedsUpdates = CurrentWeapon->Tick(DeltaTime);
 			}
 		}
 	}
+
+	// Nothing is blending, only poll for movement / stance changes until something starts to
+	// Anything reading the spread (firing, the reticle) brings the multipliers up to date first, see ULyraRangedWeaponInstance::UpdateSpreadMultipliers
+	SetComponentTickInterval(bNeedsUpdates ? 0.0f : FMath::Max(LyraConsoleVariables::WeaponIdleTickInterval, 0.0f));
 }
 
 bool ULyraWeaponStateComponent::ShouldShowHitAsSuccess(const FHitResult& Hit) const